@@ -0,0 +1,119 @@
+#include "BenchReport.hpp"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+
+const double BenchReport::MIN_SAMPLE_SECONDS = 0.05;
+const int BenchReport::SAMPLES = 5;
+const std::uint64_t BenchReport::MAX_CALLS = 1ull << 30;
+const double BenchReport::DEFAULT_TOLERANCE = 0.10; // 중앙값 기준이라 반복 실행 간 편차는 보통 수 % 이내
+
+BenchReport::BenchReport(const std::string& filter) : m_filter(filter) {}
+
+bool BenchReport::selected(const std::string& name) const {
+    return m_filter.empty() || name.find(m_filter) != std::string::npos;
+}
+
+void BenchReport::add(const std::string& name, double nsPerOp, std::uint64_t ops) {
+    m_results.push_back({name, nsPerOp, ops});
+    std::cerr << "  " << name << ": " << std::fixed << std::setprecision(2) << nsPerOp << " ns/op" << std::endl; // 진행 상황
+}
+
+const std::vector<BenchResult>& BenchReport::results() const { return m_results; }
+
+void BenchReport::printTable(std::ostream& out) const {
+    out << "name,ns_per_op,ops_per_second\n";
+    for (const auto& r : m_results) {
+        out << r.name << ',' << std::fixed << std::setprecision(3) << r.nsPerOp << ','
+            << std::setprecision(0) << 1e9 / r.nsPerOp << '\n';
+    }
+}
+
+bool BenchReport::writeJson(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Error: Could not open file to save benchmark results: " << path << std::endl;
+        return false;
+    }
+    out << "{\n  \"context\": {\"threads\": " << std::max(1u, std::thread::hardware_concurrency())
+#if defined(__VERSION__)
+        << ", \"compiler\": \"" << __VERSION__ << '"'
+#endif
+        << "},\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < m_results.size(); ++i) {
+        const BenchResult& r = m_results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"ns_per_op\": " << std::fixed << std::setprecision(3) << r.nsPerOp
+            << ", \"ops_per_second\": " << std::setprecision(0) << 1e9 / r.nsPerOp << ", \"ops\": " << r.ops << '}'
+            << (i + 1 < m_results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+// 한 줄에서 "key": 뒤의 값 (문자열이면 따옴표 안, 숫자면 숫자 부분)
+static bool jsonField(const std::string& line, const std::string& key, std::string& value) {
+    std::size_t pos = line.find("\"" + key + "\"");
+    if (pos == std::string::npos) return false;
+    pos = line.find(':', pos);
+    if (pos == std::string::npos) return false;
+    pos = line.find_first_not_of(' ', pos + 1);
+    if (pos == std::string::npos) return false;
+    if (line[pos] == '"') {
+        std::size_t end = line.find('"', pos + 1);
+        if (end == std::string::npos) return false;
+        value = line.substr(pos + 1, end - pos - 1);
+    } else {
+        std::size_t end = line.find_first_of(",}", pos);
+        value = line.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+    }
+    return true;
+}
+
+// 기준 파일은 writeJson() 출력 (벤치마크 하나가 한 줄)
+int BenchReport::compareBaseline(const std::string& path, double tolerance, std::ostream& out) const {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Error: Could not open baseline file: " << path << std::endl;
+        return -1;
+    }
+    std::map<std::string, double> baseline;
+    std::string line, name, value;
+    while (std::getline(in, line)) {
+        if (!jsonField(line, "name", name) || !jsonField(line, "ns_per_op", value)) continue;
+        try { baseline[name] = std::stod(value); }
+        catch (const std::exception&) { std::cerr << "Warning: Ignoring invalid baseline entry: " << line << std::endl; }
+    }
+
+    int regressions = 0;
+    out << "name,baseline_ns,current_ns,change,status\n";
+    for (const auto& r : m_results) {
+        auto it = baseline.find(r.name);
+        if (it == baseline.end() || it->second <= 0.0) {
+            out << r.name << ",," << std::fixed << std::setprecision(3) << r.nsPerOp << ",,new\n"; // 기준에 없는 벤치마크
+            continue;
+        }
+        double change = r.nsPerOp / it->second - 1.0; // 양수면 느려짐
+        const char* status = change > tolerance ? "REGRESSION" : (change < -tolerance ? "improved" : "ok");
+        if (change > tolerance) ++regressions;
+        out << r.name << ',' << std::fixed << std::setprecision(3) << it->second << ',' << r.nsPerOp << ','
+            << std::showpos << std::setprecision(1) << change * 100.0 << '%' << std::noshowpos << ',' << status << '\n';
+    }
+    return regressions;
+}
+
+int BenchReport::finish(const std::string& jsonPath, const std::string& baselinePath, double tolerance) const {
+    printTable(std::cout);
+    if (!jsonPath.empty() && !writeJson(jsonPath)) return 1;
+    if (baselinePath.empty()) return 0;
+    std::cout << '\n';
+    int regressions = compareBaseline(baselinePath, tolerance, std::cout);
+    if (regressions < 0) return 1;
+    if (regressions > 0) {
+        std::cerr << "Error: " << regressions << " benchmark(s) slower than the baseline by more than "
+                  << tolerance * 100.0 << "%." << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+#ifndef BENCH_REPORT_HPP
+#define BENCH_REPORT_HPP
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <ostream>
+#include <cstdint>
+
+// 벤치마크 결과 하나
+struct BenchResult {
+    std::string name;     // "분류.대상/크기" 형식 이름
+    double nsPerOp;       // 연산 하나당 시간 (ns, 표본 중앙값)
+    std::uint64_t ops;    // 표본 하나에서 실행한 연산 수
+};
+
+// 벤치마크 실행, 결과 표/JSON 출력, 기준 결과와 비교 (iaps_bench, iaps_bench_frames 공용)
+// measure()는 한 번 호출이 MIN_SAMPLE_SECONDS 이상 걸리도록 반복 횟수를 맞춘 뒤 SAMPLES개 표본의 중앙값을 기록
+// JSON은 벤치마크 하나를 한 줄에 쓰므로 기준 파일은 같은 형식의 이전 출력을 그대로 사용
+class BenchReport {
+public:
+    // 이름에 filter가 들어 있는 벤치마크만 실행 (빈 문자열이면 전부)
+    explicit BenchReport(const std::string& filter = "");
+
+    bool selected(const std::string& name) const;
+
+    // body()를 한 번 호출할 때 opsPerCall개 연산을 실행하는 벤치마크 측정 (선택되지 않았으면 실행하지 않음)
+    template <typename Body>
+    void measure(const std::string& name, std::uint64_t opsPerCall, Body&& body) {
+        if (!selected(name)) return;
+        using Clock = std::chrono::steady_clock;
+        body(); // 예열 (페이지 첫 접근, 캐시, 분기 예측)
+        std::uint64_t calls = 1;
+        while (true) { // 표본 하나가 MIN_SAMPLE_SECONDS 이상 걸리는 호출 횟수 찾기
+            auto begin = Clock::now();
+            for (std::uint64_t i = 0; i < calls; ++i) body();
+            double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+            if (seconds >= MIN_SAMPLE_SECONDS || calls >= MAX_CALLS) break;
+            calls *= 2;
+        }
+        std::vector<double> samples;
+        for (int s = 0; s < SAMPLES; ++s) {
+            auto begin = Clock::now();
+            for (std::uint64_t i = 0; i < calls; ++i) body();
+            samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / static_cast<double>(calls * opsPerCall));
+        }
+        std::nth_element(samples.begin(), samples.begin() + SAMPLES / 2, samples.end());
+        add(name, samples[SAMPLES / 2], calls * opsPerCall);
+    }
+    // 직접 측정한 결과 추가
+    void add(const std::string& name, double nsPerOp, std::uint64_t ops);
+
+    const std::vector<BenchResult>& results() const;
+    // "name,ns_per_op,ops_per_second" 표 출력
+    void printTable(std::ostream& out) const;
+    // {"context": {...}, "benchmarks": [{"name", "ns_per_op", "ops_per_second", "ops"}, ...]} 저장 (실패하면 false)
+    bool writeJson(const std::string& path) const;
+    // 기준 JSON과 비교해 tolerance(비율)보다 느려진 벤치마크 수 반환 (-1이면 기준 파일 읽기 실패)
+    int compareBaseline(const std::string& path, double tolerance, std::ostream& out) const;
+    // 표 출력 → JSON 저장 (경로가 있으면) → 기준 비교 (경로가 있으면), 프로그램 종료 코드 반환 (실패나 회귀가 있으면 1)
+    int finish(const std::string& jsonPath, const std::string& baselinePath, double tolerance) const;
+
+    static const double MIN_SAMPLE_SECONDS; // 표본 하나의 최소 시간 (초)
+    static const int SAMPLES;               // 표본 수 (중앙값 사용)
+    static const std::uint64_t MAX_CALLS;   // 표본 하나의 최대 호출 횟수
+    static const double DEFAULT_TOLERANCE;  // 기본 회귀 판정 비율
+
+private:
+    std::string m_filter;
+    std::vector<BenchResult> m_results;
+};
+
+// 최적화로 결과 계산이 사라지지 않도록 값을 사용한 것으로 표시
+template <typename T>
+inline void benchKeep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#endif
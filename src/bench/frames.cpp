@@ -0,0 +1,131 @@
+#include <SFML/Graphics.hpp>
+#include "../core/ParticleCloud.hpp"
+#include "../core/ThreadPool.hpp"
+#include "../screen/RoomScene.hpp"
+#include "BenchReport.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// iaps_bench_frames: 시뮬레이션 화면의 3D 영역 한 프레임(파티클 계산 → 투영/사각형 생성 → 방 선 → 파티클 그리기)을
+// 화면 밖 렌더 텍스처에 그려 프레임당 시간을 측정 (SFML 필요, 결과 형식과 기준 비교는 iaps_bench --suite와 같음)
+// display()까지의 CPU 쪽 제출 시간이며, GPU 실행은 다음 프레임과 겹칠 수 있어 드라이버 대기가 생길 때만 포함됨
+
+static const unsigned FRAME_WIDTH = 820;  // 기본 창(1366x768)에서 3D 뷰(너비 60%) 크기
+static const unsigned FRAME_HEIGHT = 768;
+static const float PARTICLE_RADIUS = 2.f;           // SimulationScreen과 같은 값
+static const unsigned PARTICLE_TEXTURE_SIZE = 32;
+static const double FRAME_DT = 1.0 / 60.0;
+
+// 벤치마크 설정
+struct FrameOptions {
+    std::string filter;       // 이름에 이 문자열이 들어간 벤치마크만
+    std::string jsonPath;     // 결과 JSON 저장 경로
+    std::string baselinePath; // 비교할 기준 JSON
+    double tolerance = BenchReport::DEFAULT_TOLERANCE; // 회귀 판정 비율
+};
+
+// 사용법 출력
+static void printUsage() {
+    std::cerr << "Usage: iaps_bench_frames [options]\n"
+              << "  --filter S      only benchmarks whose name contains S\n"
+              << "  --json PATH     write results as JSON\n"
+              << "  --baseline PATH compare with an earlier --json file, exit 1 on regressions\n"
+              << "  --tolerance F   allowed slowdown ratio before a regression (default 0.10)\n";
+}
+
+// SimulationScreen::setup3D()와 같은 가장자리를 부드럽게 처리한 흰색 원 텍스처
+static void createParticleTexture(sf::Texture& texture) {
+    sf::Image circle;
+    circle.create(PARTICLE_TEXTURE_SIZE, PARTICLE_TEXTURE_SIZE, sf::Color::Transparent);
+    float center = PARTICLE_TEXTURE_SIZE * 0.5f;
+    for (unsigned y = 0; y < PARTICLE_TEXTURE_SIZE; ++y) {
+        for (unsigned x = 0; x < PARTICLE_TEXTURE_SIZE; ++x) {
+            float dx = x + 0.5f - center, dy = y + 0.5f - center;
+            float coverage = std::clamp(center - std::sqrt(dx * dx + dy * dy), 0.f, 1.f);
+            circle.setPixel(x, y, sf::Color(255, 255, 255, static_cast<sf::Uint8>(coverage * 255.f)));
+        }
+    }
+    texture.loadFromImage(circle);
+    texture.setSmooth(true);
+}
+
+// 시뮬레이션 화면 초기 상태와 같은 장면: 5 x 5 x 3 m 방, 초기 회전각, 좌우 벽 창문 2개
+static void setupScene(RoomScene& scene) {
+    const float PI = 3.14159265f;
+    scene.setCenter(sf::Vector2f(FRAME_WIDTH / 2.f, FRAME_HEIGHT / 2.f));
+    scene.setRotation(25.f * PI / 180.f, -35.f * PI / 180.f);
+    scene.setColors(sf::Color::White, sf::Color::Cyan);
+    scene.setRoomSize(5.f, 5.f, 3.f);
+    const float h = 0.2f, d = 0.15f; // 창문 반높이/반폭 (정규화 좌표)
+    scene.addOpening({{{-0.5f, -h, -d}, {-0.5f, -h, d}, {-0.5f, h, d}, {-0.5f, h, -d}}});
+    scene.addOpening({{{0.5f, -h, -d}, {0.5f, -h, d}, {0.5f, h, d}, {0.5f, h, -d}}});
+}
+
+// 프레임 벤치마크 실행: 방 선만 그리는 프레임(설정 화면에 해당)과 파티클 수별 시뮬레이션 프레임
+static bool runFrameBenchmarks(BenchReport& report) {
+    sf::RenderTexture target;
+    if (!target.create(FRAME_WIDTH, FRAME_HEIGHT)) {
+        std::cerr << "Error: Could not create an offscreen render texture (no OpenGL context?)" << std::endl;
+        return false;
+    }
+    sf::Texture particleTexture;
+    createParticleTexture(particleTexture);
+    RoomScene scene;
+    setupScene(scene);
+
+    report.measure("frame.room", 1, [&] {
+        target.clear(sf::Color::Black);
+        scene.draw(target);
+        target.display();
+    });
+
+    ThreadPool pool;
+    ParticleCloud cloud;
+    cloud.setThreadPool(&pool);
+    sf::VertexArray vertices(sf::Triangles);
+    const sf::Color particleColor(100, 100, 100);
+    for (std::size_t n : {1000u, 5000u, 20000u, 100000u}) {
+        std::vector<float> x(n), y(n), z(n), alpha(n);
+        double t = 0.0;
+        report.measure("frame.simulation/" + std::to_string(n), 1, [&] {
+            t += FRAME_DT;
+            cloud.evaluate(t, n, x.data(), y.data(), z.data(), alpha.data());
+            scene.buildParticleQuads(x.data(), y.data(), z.data(), alpha.data(), n, particleColor, PARTICLE_RADIUS,
+                                     static_cast<float>(PARTICLE_TEXTURE_SIZE), vertices);
+            target.clear(sf::Color::Black);
+            scene.draw(target);
+            target.draw(vertices, &particleTexture);
+            target.display();
+        });
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    FrameOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") { printUsage(); return 0; }
+        if (i + 1 >= argc) { std::cerr << "Error: Missing value for " << arg << std::endl; printUsage(); return 1; }
+        std::string value = argv[++i];
+        try {
+            if (arg == "--filter") options.filter = value;
+            else if (arg == "--json") options.jsonPath = value;
+            else if (arg == "--baseline") options.baselinePath = value;
+            else if (arg == "--tolerance") options.tolerance = std::stod(value);
+            else { std::cerr << "Error: Unknown option " << arg << std::endl; printUsage(); return 1; }
+        } catch (const std::exception&) {
+            std::cerr << "Error: Invalid value for " << arg << ": " << value << std::endl;
+            return 1;
+        }
+    }
+
+    BenchReport report(options.filter);
+    std::cerr << "Running frame benchmarks (" << FRAME_WIDTH << "x" << FRAME_HEIGHT << " offscreen, median of "
+              << BenchReport::SAMPLES << " samples)" << std::endl;
+    if (!runFrameBenchmarks(report)) return 1;
+    return report.finish(options.jsonPath, options.baselinePath, options.tolerance);
+}
@@ -0,0 +1,439 @@
+#include "../core/ConcentrationField.hpp"
+#include "../core/ThreadPool.hpp"
+#include "../core/ParticleCloud.hpp"
+#include "../core/PopulationRamp.hpp"
+#include "../core/Philox.hpp"
+#include "../core/ViewTransform.hpp"
+#include "../core/Model.hpp"
+#include "../core/ZoneNetwork.hpp"
+#include "../core/FloorplanFile.hpp"
+#include "../core/RoomMesh.hpp"
+#include "../core/TimeSeriesRecorder.hpp"
+#include "../core/Scenario.hpp"
+#include "BenchReport.hpp"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <iomanip>
+#include <cmath>
+#include <thread>
+#include <algorithm>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+#include <map>
+
+// iaps_bench: 3D 농도장 스텐실 처리량(GLUP/s, 초당 10억 격자점 갱신) 및 파티클 구름 계산 시간 측정 도구
+// --suite는 코어 경로(모델, 파티클, 파티클 수 곡선, 난수, 투영, 농도장, 건물 파일 열기, 다면체 방)의 마이크로벤치마크를 실행해 JSON으로 저장하고 기준과 비교
+
+// 벤치마크 설정
+struct BenchOptions {
+    int size = 256;                // 정육면체 격자 한 변의 셀 수
+    int steps = 8;                 // 측정할 시간 단계 수
+    std::vector<unsigned> threads; // 측정할 스레드 수 목록 (비어 있으면 1과 하드웨어 코어 수)
+    std::size_t particles = 0;     // 0보다 크면 농도장 대신 파티클 구름 계산 측정
+    bool suite = false;            // 마이크로벤치마크 모음 실행
+    std::string filter;            // 이름에 이 문자열이 들어간 벤치마크만 (--suite)
+    std::string jsonPath;          // 결과 JSON 저장 경로 (--suite)
+    std::string baselinePath;      // 비교할 기준 JSON (--suite)
+    double tolerance = BenchReport::DEFAULT_TOLERANCE; // 회귀 판정 비율
+};
+
+// 사용법 출력
+static void printUsage() {
+    std::cerr << "Usage: iaps_bench [options]\n"
+              << "  --size N        cubic grid with N cells per axis (default 256)\n"
+              << "  --steps N       time steps per run (default 8)\n"
+              << "  --threads L     comma-separated worker counts (default: 1 and all cores)\n"
+              << "  --particles N   measure ParticleCloud::evaluate with N particles instead of the field\n"
+              << "  --suite         run the core microbenchmark suite\n"
+              << "  --filter S      suite: only benchmarks whose name contains S\n"
+              << "  --json PATH     suite: write results as JSON\n"
+              << "  --baseline PATH suite: compare with an earlier --json file, exit 1 on regressions\n"
+              << "  --tolerance F   suite: allowed slowdown ratio before a regression (default 0.10)\n";
+}
+
+// 벤치마크용 방 구성: 한 변 10 m 정육면체, 왼쪽 창문 하나 (외부 교환만 있어 유동 계산 없이 바로 시작)
+static void configureField(ConcentrationField& field, int size) {
+    RoomConfig room{10.f, 10.f, 10.f, 0, 0, 1};
+    std::vector<FieldOpening> openings = ConcentrationField::defaultOpenings(room);
+    float volume = ConcentrationModel::roomVolume(room);
+    field.configure(room.width, room.depth, room.height, size, openings);
+    field.setParameters(ConcentrationModel::BASE_S_PM10, ConcentrationField::bulkDecay(ConcentrationModel::BASE_K_PM10, volume, openings));
+    field.reset(100.f);
+}
+
+// steps 단계 진행 시간 (초)
+static double timeSteps(ConcentrationField& field, int steps) {
+    auto begin = std::chrono::steady_clock::now();
+    field.advanceSteps(steps);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+static double glups(const ConcentrationField& field, int steps, double seconds) {
+    return static_cast<double>(field.cellCount()) * steps / seconds * 1e-9;
+}
+
+// 파티클 N개의 구름을 60 FPS 프레임 간격의 --steps개 시간에서 계산해 프레임당 시간 측정
+// 연속 프레임은 세대 캐시 덕에 세대가 바뀐 파티클만 난수를 다시 뽑고, 탐색(PERIOD보다 멀리 이동)은 구름 전체를 다시 뽑음
+static int runParticleBench(const BenchOptions& options) {
+    const double FRAME_DT = 1.0 / 60.0;
+    std::vector<float> x(options.particles), y(options.particles), z(options.particles), alpha(options.particles);
+
+    std::cout << options.particles << " particles, " << options.steps << " frames\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "threads,ms_per_frame,particles_per_second,ms_per_seek\n";
+    for (unsigned threads : options.threads) {
+        ThreadPool pool(threads);
+        ParticleCloud particles; // 기본 시드로 재현 가능
+        if (pool.size() > 1) particles.setThreadPool(&pool);
+        particles.evaluate(0.0, options.particles, x.data(), y.data(), z.data(), alpha.data()); // 페이지 첫 접근 및 캐시 예열
+        auto begin = std::chrono::steady_clock::now();
+        for (int frame = 1; frame <= options.steps; ++frame) {
+            particles.evaluate(frame * FRAME_DT, options.particles, x.data(), y.data(), z.data(), alpha.data());
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - begin).count() / options.steps;
+        begin = std::chrono::steady_clock::now();
+        for (int seek = 1; seek <= options.steps; ++seek) { // 매번 모든 파티클의 세대가 바뀌는 거리로 이동
+            particles.evaluate(seek * 2.5 * ParticleCloud::PERIOD, options.particles, x.data(), y.data(), z.data(), alpha.data());
+        }
+        end = std::chrono::steady_clock::now();
+        double seekMs = std::chrono::duration<double, std::milli>(end - begin).count() / options.steps;
+        std::cout << pool.size() << ',' << ms << ',' << std::setprecision(0)
+                  << static_cast<double>(options.particles) / ms * 1e3 << std::setprecision(3) << ',' << seekMs << '\n';
+    }
+    return 0;
+}
+
+// 벤치마크용 다면체 방 OBJ: 6 x 4 x 3 m 상자의 각 면을 s x s 격자(사각형당 삼각형 2개)로 나누고
+// 정점을 위치의 함수로 살짝 흔들어(공유 정점은 같은 값) 닫힌 울퉁불퉁한 표면을 만듦 (삼각형 12 s²개)
+static void writeBenchRoomMesh(const std::string& path, int s) {
+    std::ofstream out(path);
+    std::map<long long, int> index; // 격자 좌표 (i, j, k) → OBJ 정점 번호 (면끼리 모서리 정점 공유)
+    auto vertex = [&](int i, int j, int k) {
+        long long key = (static_cast<long long>(i) * (s + 1) + j) * (s + 1) + k;
+        auto found = index.find(key);
+        if (found != index.end()) return found->second;
+        float x = 6.f * i / s, y = 3.f * j / s, z = 4.f * k / s;
+        float bump = 0.01f * std::sin(7.f * x + 5.f * z) * std::sin(9.f * y); // 1 cm 요철
+        out << "v " << x + bump << ' ' << y + bump << ' ' << z - bump << '\n';
+        int number = static_cast<int>(index.size()) + 1;
+        index[key] = number;
+        return number;
+    };
+    // 축 하나를 0 또는 s로 고정한 면마다 나머지 두 축의 격자 (법선이 바깥을 향하도록 0쪽 면은 감는 방향을 뒤집음)
+    for (int axis = 0; axis < 3; ++axis) {
+        for (int side : {0, s}) {
+            for (int a = 0; a < s; ++a) {
+                for (int b = 0; b < s; ++b) {
+                    int corners[4];
+                    const int da[4] = {0, 1, 1, 0}, db[4] = {0, 0, 1, 1};
+                    for (int c = 0; c < 4; ++c) {
+                        int p[3];
+                        p[axis] = side;
+                        p[(axis + 1) % 3] = a + da[c];
+                        p[(axis + 2) % 3] = b + db[c];
+                        corners[c] = vertex(p[0], p[1], p[2]);
+                    }
+                    if (side == 0) std::swap(corners[1], corners[3]);
+                    out << "f " << corners[0] << ' ' << corners[1] << ' ' << corners[2] << '\n';
+                    out << "f " << corners[0] << ' ' << corners[2] << ' ' << corners[3] << '\n';
+                }
+            }
+        }
+    }
+}
+
+// 코어 마이크로벤치마크 (이름 = 분류.대상/크기, 연산 하나 = 이름의 대상 하나)
+static void runMicroBenchmarks(BenchReport& report) {
+    // 완전 혼합 모델: 시간 하나의 해석해 C(t)
+    {
+        ModelParams params = ConcentrationModel::defaultParams({5.f, 5.f, 3.f, 0, 1, 1}, 100.f);
+        const int N = 1024;
+        report.measure("model.concentrationAt", N, [&] {
+            float sum = 0.f;
+            for (int i = 0; i < N; ++i) sum += ConcentrationModel::concentrationAt(params, static_cast<float>(i) * 1.5f);
+            benchKeep(sum);
+        });
+    }
+
+    // 상태 없는 파티클 구름 (연산 하나 = 파티클 하나, 단일 스레드와 모든 코어)
+    for (std::size_t n : {std::size_t(1000), std::size_t(100000)}) {
+        std::vector<float> x(n), y(n), z(n), alpha(n);
+        ParticleCloud cloud;
+        double t = 0.0;
+        report.measure("particles.evaluate/" + std::to_string(n), n, [&] {
+            t += 1.0 / 60.0;
+            cloud.evaluate(t, n, x.data(), y.data(), z.data(), alpha.data());
+            benchKeep(alpha[n - 1]);
+        });
+    }
+    {
+        const std::size_t n = 100000;
+        std::vector<float> x(n), y(n), z(n), alpha(n);
+        ParticleCloud cloud;
+        double t = 0.0;
+        report.measure("particles.seek/" + std::to_string(n), n, [&] { // 세대 캐시가 전부 무효가 되는 이동
+            t += 2.5 * ParticleCloud::PERIOD;
+            cloud.evaluate(t, n, x.data(), y.data(), z.data(), alpha.data());
+            benchKeep(alpha[n - 1]);
+        });
+    }
+    {
+        const std::size_t n = 100000;
+        std::vector<float> x(n), y(n), z(n), alpha(n);
+        ThreadPool pool;
+        ParticleCloud cloud;
+        cloud.setThreadPool(&pool);
+        double t = 0.0;
+        report.measure("particles.evaluate.parallel/" + std::to_string(n), n, [&] {
+            t += 1.0 / 60.0;
+            cloud.evaluate(t, n, x.data(), y.data(), z.data(), alpha.data());
+            benchKeep(alpha[n - 1]);
+        });
+    }
+
+    // 파티클 수 곡선: 목표 변경(10만 개 생성/소멸) + 표시 개수 계산 (연산 하나 = 변경 하나)
+    {
+        PopulationRamp ramp;
+        double now = 0.0;
+        std::size_t target = 0;
+        report.measure("population.retarget/100000", 1, [&] {
+            now += 0.01;
+            target = target == 0 ? 100000 : 0;
+            ramp.retarget(target, now);
+            benchKeep(ramp.value(now + 0.5));
+        });
+    }
+
+    // Philox 일괄 난수 (연산 하나 = 4워드 블록 하나)
+    {
+        const std::size_t n = ParticleCloud::CHUNK;
+        std::vector<std::uint32_t> generation(n, 7u);
+        std::vector<float> a(n), b(n), c(n), d(n);
+        const Philox::Key key = {1u, 2u};
+        std::uint32_t first = 0;
+        report.measure("philox.uniformBatch/" + std::to_string(n), n, [&] {
+            Philox::uniformBatch(key, first, generation.data(), 0u, 0u, a.data(), b.data(), c.data(), d.data(), n);
+            first += static_cast<std::uint32_t>(n);
+            benchKeep(d[n - 1]);
+        });
+    }
+
+    // 파티클 화면 투영: 렌더링의 일괄 투영과 점 하나씩 투영 (연산 하나 = 파티클 하나)
+    {
+        const std::size_t n = 100000;
+        std::vector<float> x(n), y(n), z(n), alpha(n), sx(n), sy(n), sp(n);
+        ParticleCloud().evaluate(1.0, n, x.data(), y.data(), z.data(), alpha.data());
+        ViewTransform transform;
+        transform.update(0.44f, -0.61f, 5.f, 5.f, 3.f, 410.f, 384.f);
+        report.measure("projection.batch/" + std::to_string(n), n, [&] {
+            transform.projectBatch(x.data(), y.data(), z.data(), sx.data(), sy.data(), sp.data(), n);
+            benchKeep(sp[n - 1]);
+        });
+        report.measure("projection.scalar/" + std::to_string(n), n, [&] {
+            for (std::size_t i = 0; i < n; ++i) transform.project({x[i], y[i], z[i]}, sx[i], sy[i], sp[i]);
+            benchKeep(sp[n - 1]);
+        });
+    }
+
+    // 농도장 한 단계 (연산 하나 = 격자점 하나, 시뮬레이션 화면 기본 해상도와 최고 화질 해상도)
+    for (int size : {ConcentrationField::DEFAULT_RESOLUTION, 96}) {
+        if (!report.selected("field.step/" + std::to_string(size))) continue;
+        ConcentrationField field;
+        configureField(field, size);
+        report.measure("field.step/" + std::to_string(size), field.cellCount(), [&] { field.advanceSteps(1); });
+    }
+
+    // 10만 개 방 건물 파일 열기 (연산 하나 = 파일 하나): 바이너리 매핑만, 바이너리/텍스트에서 구역 네트워크 구성
+    if (report.selected("floorplan.open/100000") || report.selected("zones.load")) {
+        const std::size_t n = 100000;
+        std::filesystem::path dir = std::filesystem::temp_directory_path();
+        std::string textPath = (dir / "iaps_bench_floorplan.txt").string(), binaryPath = (dir / "iaps_bench_floorplan.flr").string();
+        {
+            std::ofstream text(textPath);
+            for (std::size_t i = 0; i < n; ++i) text << "zone,4.5,5,3," << i % 3 << ',' << i % 2 << ",100\n";
+            for (std::size_t i = 1; i < n; ++i) text << "passage," << i - 1 << ',' << i << '\n';
+        }
+        std::vector<FloorplanRoom> rooms;
+        std::vector<FloorplanOpening> openings;
+        if (ZoneNetwork::readTextFile(textPath, rooms, openings) && FloorplanFile::write(binaryPath, rooms, openings)) {
+            report.measure("floorplan.open/" + std::to_string(n), 1, [&] {
+                FloorplanFile file;
+                file.open(binaryPath);
+                benchKeep(file.rooms()[file.roomCount() - 1].C0);
+            });
+            report.measure("zones.load.binary/" + std::to_string(n), 1, [&] {
+                ZoneNetwork network;
+                network.loadFromFile(binaryPath);
+                benchKeep(network.size());
+            });
+            report.measure("zones.load.text/" + std::to_string(n), 1, [&] {
+                ZoneNetwork network;
+                network.loadFromFile(textPath);
+                benchKeep(network.size());
+            });
+        }
+        std::filesystem::remove(textPath);
+        std::filesystem::remove(binaryPath);
+    }
+
+    // 삼각형 10만 개 다면체 방: 파일 불러오기(파싱, 부피, 윤곽선, 복셀 마스크, 연산 하나 = 파일 하나)와
+    // 파티클 구름 위치의 포함 판정 (연산 하나 = 파티클 하나, 다면체 방에서 틱마다 더해지는 비용)
+    if (report.selected("mesh.load/100000") || report.selected("mesh.contains/100000")) {
+        const int subdivisions = 91; // 12 × 91² = 99372 삼각형
+        std::string meshPath = (std::filesystem::temp_directory_path() / "iaps_bench_room.obj").string();
+        writeBenchRoomMesh(meshPath, subdivisions);
+        RoomMesh mesh;
+        if (mesh.loadFromFile(meshPath)) {
+            report.measure("mesh.load/100000", 1, [&] {
+                RoomMesh loaded;
+                loaded.loadFromFile(meshPath);
+                benchKeep(loaded.volume());
+            });
+            const std::size_t n = 100000;
+            std::vector<float> x(n), y(n), z(n), alpha(n);
+            ParticleCloud cloud;
+            cloud.evaluate(1.0, n, x.data(), y.data(), z.data(), alpha.data());
+            report.measure("mesh.contains/" + std::to_string(n), n, [&] {
+                std::size_t inside = 0;
+                for (std::size_t i = 0; i < n; ++i) inside += mesh.contains({x[i], y[i], z[i]});
+                benchKeep(inside);
+            });
+        }
+        std::filesystem::remove(meshPath);
+    }
+
+    // 개구부 1000개와 mesh 줄이 있는 시나리오 저장 → 불러오기 (연산 하나 = 왕복 하나)
+    // 메시는 작게(삼각형 48개) 만들어 시나리오 파일 자체의 쓰기/파싱 비용이 대부분이 되게 함
+    if (report.selected("scenario.roundtrip/1000")) {
+        const int n = 1000;
+        std::filesystem::path dir = std::filesystem::temp_directory_path();
+        std::string meshPath = (dir / "iaps_bench_scenario_room.obj").string(), scenarioPath = (dir / "iaps_bench_scenario.iaps").string();
+        writeBenchRoomMesh(meshPath, 2);
+        auto mesh = std::make_shared<RoomMesh>();
+        if (mesh->loadFromFile(meshPath)) {
+            Scenario scenario;
+            scenario.mesh = mesh;
+            for (int i = 0; i < n; ++i) { // 여섯 면에 작은 개구부를 격자로 흩어 놓음
+                FacePlacement placement{static_cast<RoomFace>(i % 6), -0.4f + 0.8f * ((i / 6) % 13) / 12.f, -0.4f + 0.8f * ((i / 78) % 13) / 12.f, 0.02f, 0.02f};
+                scenario.openings.emplace_back(i % 2 ? OpeningKind::Window : OpeningKind::Passage, placement);
+            }
+            report.measure("scenario.roundtrip/" + std::to_string(n), 1, [&] {
+                Scenario loaded;
+                scenario.saveToFile(scenarioPath);
+                loaded.loadFromFile(scenarioPath);
+                benchKeep(loaded.openings.size());
+            });
+        }
+        std::filesystem::remove(scenarioPath);
+        std::filesystem::remove(meshPath);
+    }
+
+    // 시계열 100만 표본 기록 (연산 하나 = 표본 하나): 큐에 넣기부터 쓰기 스레드가 파일에 다 쓰고 닫을 때까지
+    // (Wait 정책이라 쓰기 스레드가 느리면 생산자가 기다리므로 지속 가능한 처리량)
+    for (TimeSeriesRecorder::Format format : {TimeSeriesRecorder::Format::Binary, TimeSeriesRecorder::Format::Csv}) {
+        const std::size_t n = 1000000;
+        bool binary = format == TimeSeriesRecorder::Format::Binary;
+        std::string name = std::string(binary ? "recorder.binary/" : "recorder.csv/") + std::to_string(n);
+        if (!report.selected(name)) continue;
+        std::string path = (std::filesystem::temp_directory_path() / (binary ? "iaps_bench_recording.rec" : "iaps_bench_recording.csv")).string();
+        std::vector<RecordSample> samples(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            double t = i * 0.01;
+            samples[i] = {t, static_cast<float>(100.0 * std::exp(-0.05 * t) + 20.0), 10.f, 0.05f, static_cast<std::uint32_t>(i % 500), 0};
+        }
+        report.measure(name, n, [&] {
+            TimeSeriesRecorder recorder;
+            recorder.start(path, format, TimeSeriesRecorder::Overflow::Wait);
+            for (std::size_t i = 0; i < n; i += TimeSeriesRecorder::BLOCK_SAMPLES) {
+                recorder.recordBatch(samples.data() + i, std::min(TimeSeriesRecorder::BLOCK_SAMPLES, n - i));
+            }
+            recorder.stop();
+            benchKeep(recorder.writtenCount());
+        });
+        std::filesystem::remove(path);
+    }
+}
+
+// 마이크로벤치마크 실행 → 표 출력 → JSON 저장 → 기준 비교 (회귀가 있으면 1)
+static int runSuite(const BenchOptions& options) {
+    BenchReport report(options.filter);
+    std::cerr << "Running microbenchmarks (median of " << BenchReport::SAMPLES << " samples)" << std::endl;
+    runMicroBenchmarks(report);
+    return report.finish(options.jsonPath, options.baselinePath, options.tolerance);
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") { printUsage(); return 0; }
+        if (arg == "--suite") { options.suite = true; continue; }
+        if (i + 1 >= argc) { std::cerr << "Error: Missing value for " << arg << std::endl; printUsage(); return 1; }
+        std::string value = argv[++i];
+        try {
+            if (arg == "--size") options.size = std::stoi(value);
+            else if (arg == "--steps") options.steps = std::stoi(value);
+            else if (arg == "--particles") options.particles = static_cast<std::size_t>(std::stoull(value));
+            else if (arg == "--filter") options.filter = value;
+            else if (arg == "--json") options.jsonPath = value;
+            else if (arg == "--baseline") options.baselinePath = value;
+            else if (arg == "--tolerance") options.tolerance = std::stod(value);
+            else if (arg == "--threads") {
+                std::stringstream ss(value);
+                std::string item;
+                while (std::getline(ss, item, ',')) options.threads.push_back(static_cast<unsigned>(std::stoi(item)));
+            } else { std::cerr << "Error: Unknown option " << arg << std::endl; printUsage(); return 1; }
+        } catch (const std::exception&) {
+            std::cerr << "Error: Invalid value for " << arg << ": " << value << std::endl;
+            return 1;
+        }
+    }
+    if (options.suite) return runSuite(options);
+    if (options.size < 4 || options.steps < 1) { std::cerr << "Error: --size must be >= 4 and --steps >= 1" << std::endl; return 1; }
+    if (options.threads.empty()) {
+        options.threads.push_back(1);
+        unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+        if (hardware > 1) options.threads.push_back(hardware);
+    }
+    if (options.particles > 0) return runParticleBench(options);
+
+    // 기준: 풀 없는 단일 스레드 y 블로킹 경로
+    ConcentrationField reference;
+    configureField(reference, options.size);
+    double referenceSeconds = timeSteps(reference, options.steps);
+    double referenceRate = glups(reference, options.steps, referenceSeconds);
+    std::cout << "grid " << reference.nx() << "x" << reference.ny() << "x" << reference.nz()
+              << ", " << options.steps << " steps, tile " << ConcentrationField::TILE_Y << "x" << ConcentrationField::TILE_Z
+              << ", temporal block " << ConcentrationField::TEMPORAL_BLOCK << "\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "threads,path,seconds,GLUP/s,speedup,max_abs_diff\n";
+    std::cout << "1,serial," << referenceSeconds << ',' << referenceRate << ",1.000,0\n";
+
+    bool ok = true;
+    for (unsigned threads : options.threads) {
+        // 풀을 먼저 지정해 격자 배열을 작업자들이 첫 접근하도록 함
+        ThreadPool pool(threads);
+        auto field = std::make_unique<ConcentrationField>();
+        field->setThreadPool(&pool);
+        configureField(*field, options.size);
+        double seconds = timeSteps(*field, options.steps);
+
+        float maxDiff = 0.f;
+        for (int k = 0; k < field->nz(); ++k) {
+            for (int j = 0; j < field->ny(); ++j) {
+                for (int i = 0; i < field->nx(); ++i) maxDiff = std::max(maxDiff, std::fabs(field->cell(i, j, k) - reference.cell(i, j, k)));
+            }
+        }
+        if (maxDiff != 0.f) ok = false; // 같은 연산 순서이므로 비트 단위로 같아야 함
+        std::cout << pool.size() << ",tiled," << seconds << ',' << glups(*field, options.steps, seconds) << ','
+                  << referenceSeconds / seconds << ',' << std::setprecision(6) << maxDiff << std::setprecision(3) << '\n';
+    }
+    if (!ok) { std::cerr << "Error: Tiled result differs from the serial reference." << std::endl; return 1; }
+    return 0;
+}
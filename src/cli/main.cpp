@@ -0,0 +1,647 @@
+#include "../core/Model.hpp"
+#include "../core/BatchEngine.hpp"
+#include "../core/Sweep.hpp"
+#include "../core/ThreadPool.hpp"
+#include "../core/TrajectoryKernel.hpp"
+#include "../core/ZoneNetwork.hpp"
+#include "../core/SparseZoneNetwork.hpp"
+#include "../core/ConcentrationField.hpp"
+#include "../core/Philox.hpp"
+#include "../core/Scenario.hpp"
+#include "../core/RoomMesh.hpp"
+#include "../core/TimeSeriesRecorder.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <iomanip>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <memory>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+
+// iaps_cli: GUI 없이 C(t) 모델을 배치로 평가하는 명령줄 도구
+
+// 명령줄에서 지정한 단일 시나리오 값 (S, K는 지정하지 않으면 오염물질/개구부 기본값 사용)
+struct CliScenario {
+    RoomConfig room{5.f, 5.f, 3.f, 0, 0, 0}; // 방 기본 크기 및 설정 (GUI 기본값과 동일)
+    float C0 = 100.0f; // 초기 농도 기본값
+    bool hasS = false, hasK = false; // S, K 직접 지정 여부
+    float S = 0.f, K = 0.f;
+    std::vector<ScenarioOpening> openings; // --load로 불러온 개구부 형상 (비어 있으면 S, K와 --field 경계는 개수로 계산)
+    std::shared_ptr<const RoomMesh> mesh;  // --mesh 또는 --load로 불러온 다면체 방 (V는 메시 부피)
+};
+
+// 사용법 출력
+static void printUsage() {
+    std::cerr << "Usage: iaps_cli [options]\n"
+              << "  --width W --depth D --height H   room size in meters (default 5 5 3)\n"
+              << "  --pollutant P                    0|pm10, 1|co, 2|cl2 (default 0)\n"
+              << "  --passages N --windows N         opening counts (default 0)\n"
+              << "  --c0 C0 --s S --k K              model parameters (S, K default from pollutant/openings)\n"
+              << "  --load FILE                      room, pollutant and opening geometry from a scenario saved by the GUI\n"
+              << "  --mesh FILE                      polyhedral room from an OBJ/PLY file (room size = its bounding box, V = its volume;\n"
+              << "                                   a later --width/--depth/--height scales the model)\n"
+              << "  --t-end T --dt DT                time horizon and step in minutes (default 60 1)\n"
+              << "  --scenarios FILE                 CSV lines: width,depth,height,pollutant,passages,windows,c0[,s,k]\n"
+              << "  --output FILE                    output CSV (default stdout)\n"
+              << "  --record FILE                    also stream every (t, C, S, K) sample through the background recorder\n"
+              << "                                   (.csv text, otherwise compact binary columns; series column = scenario index)\n"
+              << "\n"
+              << "Sweep mode (--sweep): evaluate the Cartesian product of the grids on all cores\n"
+              << "  --grid-c0 L --grid-s L --grid-k L --grid-volume L --grid-passages L --grid-windows L\n"
+              << "                                   L is v1,v2,... or start:end:count\n"
+              << "                                   (S/K are sealed-room base values, default from --pollutant)\n"
+              << "  --threshold C                    concentration for time-to-threshold (default 50)\n"
+              << "  --at t1,t2,...                   times in minutes to report C(t) (default 60)\n"
+              << "  --threads N                      worker threads (default: all cores)\n"
+              << "  --format csv|bin                 bin writes raw float32 rows without axis columns\n"
+              << "\n"
+              << "  --zones FILE                     multi-zone network (zone/link/passage lines or binary floorplan), prints t,C_zone0,C_zone1,...\n"
+              << "  --convert OUT                    write the text --zones file as a memory-mapped binary floorplan and exit\n"
+              << "  --sparse                         solve --zones with the sparse Krylov solver (building-scale networks)\n"
+              << "  --partitions N                   zone graph partitions for --sparse (default: --threads)\n"
+              << "  --field N                        3D advection-diffusion field with N cells on the longest axis,\n"
+              << "                                   prints t,mean,max,min,well_mixed for the single room\n"
+              << "  --check-kernel                   compare the vectorized C(t) kernel against the scalar model and exit\n"
+              << "  --check-rng                      verify the Philox generator against known answers and its batched path, then exit\n"
+              << "  --check-recorder                 write binary and CSV recordings, read them back, compare and exit\n";
+}
+
+// 격자 축 목록 파싱: "v1,v2,..." 또는 "start:end:count" (실패 시 false)
+static bool parseAxis(const std::string& value, std::vector<float>& axis) {
+    axis.clear();
+    try {
+        if (value.find(':') != std::string::npos) { // 등간격 범위
+            std::stringstream ss(value);
+            std::string a, b, n;
+            if (!std::getline(ss, a, ':') || !std::getline(ss, b, ':') || !std::getline(ss, n)) return false;
+            float start = std::stof(a), stop = std::stof(b);
+            int count = std::stoi(n);
+            if (count < 1) return false;
+            for (int i = 0; i < count; ++i) {
+                axis.push_back(count == 1 ? start : start + (stop - start) * static_cast<float>(i) / static_cast<float>(count - 1));
+            }
+        } else { // 쉼표로 구분된 값 목록
+            std::stringstream ss(value);
+            std::string item;
+            while (std::getline(ss, item, ',')) axis.push_back(std::stof(item));
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    return !axis.empty();
+}
+
+// 정수 축 파싱 (실수 축 파싱 후 반올림)
+static bool parseIntAxis(const std::string& value, std::vector<int>& axis) {
+    std::vector<float> values;
+    if (!parseAxis(value, values)) return false;
+    axis.clear();
+    for (float v : values) axis.push_back(static_cast<int>(std::lround(v)));
+    return true;
+}
+
+// 오염물질 문자열(이름 또는 인덱스)을 인덱스로 변환 (실패 시 -1)
+static int parsePollutant(const std::string& value) {
+    if (value == "pm10" || value == "PM10") return 0;
+    if (value == "co" || value == "CO") return 1;
+    if (value == "cl2" || value == "Cl2" || value == "CL2") return 2;
+    try {
+        return std::stoi(value);
+    } catch (const std::exception&) {
+        return -1;
+    }
+}
+
+// 시나리오 파일 한 줄을 파싱 (성공 시 true, 오염물질 범위는 호출하는 쪽에서 확인)
+static bool parseScenarioLine(const std::string& line, CliScenario& sc) {
+    std::stringstream ss(line);
+    std::vector<std::string> fields; std::string field;
+    while (std::getline(ss, field, ',')) fields.push_back(field);
+    if (fields.size() != 7 && fields.size() != 9) return false; // S, K는 둘 다 지정하거나 둘 다 생략
+    try {
+        sc.room.width = std::stof(fields[0]);
+        sc.room.depth = std::stof(fields[1]);
+        sc.room.height = std::stof(fields[2]);
+        sc.room.pollutantIndex = parsePollutant(fields[3]);
+        sc.room.numPassages = std::stoi(fields[4]);
+        sc.room.numWindows = std::stoi(fields[5]);
+        sc.C0 = std::stof(fields[6]);
+        if (fields.size() == 9) {
+            sc.S = std::stof(fields[7]); sc.hasS = true;
+            sc.K = std::stof(fields[8]); sc.hasK = true;
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+// --load로 불러온 개구부 형상과 현재 방 크기로 만든 시나리오
+static Scenario loadedScenario(const CliScenario& sc) {
+    Scenario scenario;
+    scenario.width = sc.room.width; scenario.depth = sc.room.depth; scenario.height = sc.room.height;
+    scenario.pollutantIndex = sc.room.pollutantIndex;
+    scenario.openings = sc.openings;
+    scenario.mesh = sc.mesh;
+    return scenario;
+}
+
+// 시나리오를 모델 파라미터로 변환 (S, K 직접 지정 시 덮어씀)
+static ModelParams toParams(const CliScenario& sc) {
+    ModelParams p = ConcentrationModel::defaultParams(sc.room, sc.C0);
+    if (!sc.openings.empty()) loadedScenario(sc).defaultSK(p.S, p.K); // 개수 대신 개구부 형상으로 계산
+    if (sc.mesh) p.V = loadedScenario(sc).volume(); // 다면체 방은 경계 상자가 아닌 메시 부피
+    if (sc.hasS) p.S = sc.S;
+    if (sc.hasK) p.K = (sc.K < ConcentrationModel::MIN_K) ? ConcentrationModel::MIN_K : sc.K;
+    return p;
+}
+
+// 스윕 모드 실행: 격자 전체를 병렬 평가하고 격자점별 요약 출력
+static int runSweep(const SweepGrid& grid, const SweepOptions& options, unsigned threads,
+                    const std::string& format, const std::string& outputFile) {
+    ParameterSweep sweep(grid, options);
+    ThreadPool pool(threads);
+    std::vector<float> summary;
+    auto begin = std::chrono::steady_clock::now();
+    sweep.run(pool, summary);
+    auto end = std::chrono::steady_clock::now();
+
+    std::size_t columns = sweep.columnsPerPoint();
+    if (format == "bin") { // 원시 float32 행 (격자 순서는 decode 규칙을 따름)
+        if (outputFile.empty()) { std::cerr << "Error: --format bin requires --output" << std::endl; return 1; }
+        std::ofstream outFile(outputFile, std::ios::binary);
+        if (!outFile.is_open()) { std::cerr << "Error: Could not open output file: " << outputFile << std::endl; return 1; }
+        outFile.write(reinterpret_cast<const char*>(summary.data()), static_cast<std::streamsize>(summary.size() * sizeof(float)));
+    } else {
+        std::ofstream outFile;
+        if (!outputFile.empty()) {
+            outFile.open(outputFile);
+            if (!outFile.is_open()) { std::cerr << "Error: Could not open output file: " << outputFile << std::endl; return 1; }
+        }
+        std::ostream& out = outputFile.empty() ? std::cout : outFile;
+        out << "c0,s,k,volume,passages,windows,steady_state,t_threshold";
+        for (float t : options.sampleTimes) out << ",c_at_" << t;
+        out << '\n' << std::fixed << std::setprecision(4);
+        for (std::size_t i = 0; i < sweep.numPoints(); ++i) {
+            SweepIndex idx = sweep.decode(i);
+            out << grid.C0[idx.c0] << ',' << grid.S[idx.s] << ',' << grid.K[idx.k] << ',' << grid.volume[idx.volume] << ','
+                << grid.passages[idx.passages] << ',' << grid.windows[idx.windows];
+            const float* row = summary.data() + i * columns;
+            for (std::size_t j = 0; j < columns; ++j) out << ',' << row[j];
+            out << '\n';
+        }
+        out.flush();
+    }
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(end - begin).count();
+    std::cerr << "Swept " << sweep.numPoints() << " grid points on " << pool.size() << " threads in " << elapsedMs << " ms" << std::endl;
+    return 0;
+}
+
+// 구역 네트워크 텍스트 파일을 바이너리 평면도 파일로 변환
+static int runConvert(const std::string& zoneFile, const std::string& outputFile) {
+    std::vector<FloorplanRoom> rooms;
+    std::vector<FloorplanOpening> openings;
+    if (!ZoneNetwork::readTextFile(zoneFile, rooms, openings)) return 1;
+    if (!FloorplanFile::write(outputFile, rooms, openings)) return 1;
+    std::cerr << "Wrote " << rooms.size() << " rooms and " << openings.size() << " openings to " << outputFile << std::endl;
+    return 0;
+}
+
+// 다중 구역 모드: 구역 네트워크를 고유값 분해한 뒤 각 샘플 시간으로 바로 이동해 농도 출력
+static int runZones(const std::string& zoneFile, float tEnd, float dt, const std::string& outputFile,
+                    bool sparse, unsigned threads, std::size_t partitions) {
+    ZoneNetwork network;
+    auto loadBegin = std::chrono::steady_clock::now();
+    if (!network.loadFromFile(zoneFile)) return 1;
+    std::cerr << "Loaded " << network.size() << " zones and " << network.connections().size() << " connections in "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadBegin).count() << " ms" << std::endl;
+    ThreadPool pool(sparse ? threads : 1); // 조밀 해석기는 스레드 풀을 쓰지 않음
+    SparseZoneNetwork sparseNetwork(pool);
+    auto begin = std::chrono::steady_clock::now();
+    if (sparse ? !sparseNetwork.build(network, partitions) : !network.solve()) {
+        std::cerr << "Error: Could not solve zone network" << std::endl;
+        return 1;
+    }
+    auto solved = std::chrono::steady_clock::now();
+
+    std::ofstream outFile;
+    if (!outputFile.empty()) {
+        outFile.open(outputFile);
+        if (!outFile.is_open()) { std::cerr << "Error: Could not open output file: " << outputFile << std::endl; return 1; }
+    }
+    std::ostream& out = outputFile.empty() ? std::cout : outFile;
+    out << "t";
+    for (std::size_t i = 0; i < network.size(); ++i) out << ",zone" << i;
+    out << '\n' << std::fixed << std::setprecision(4);
+
+    BatchEngine timeline(tEnd, dt); // 샘플 시간 계산만 재사용
+    std::vector<double> concentrations;
+    double stepMs = 0.0; // 희소 해석기의 시간 전진에 걸린 시간 (출력 제외)
+    for (std::size_t s = 0; s < timeline.samplesPerScenario(); ++s) {
+        float t = timeline.sampleTime(s);
+        if (sparse) {
+            auto stepBegin = std::chrono::steady_clock::now();
+            sparseNetwork.advance(t - sparseNetwork.time()); // 이전 샘플에서 이어서 전진
+            stepMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stepBegin).count();
+            sparseNetwork.concentrations(concentrations);
+        } else {
+            network.concentrationsAt(t, concentrations);
+        }
+        out << t;
+        for (double c : concentrations) out << ',' << c;
+        out << '\n';
+    }
+    out.flush();
+
+    double solveMs = std::chrono::duration<double, std::milli>(solved - begin).count();
+    if (sparse) {
+        std::cerr << "Built " << network.size() << "-zone sparse network (" << sparseNetwork.numPartitions() << " partitions, "
+                  << sparseNetwork.numBoundaryZones() << " boundary zones) in " << solveMs << " ms, stepped to t=" << tEnd
+                  << " in " << stepMs << " ms on " << pool.size() << " threads" << std::endl;
+    } else {
+        std::cerr << "Solved " << network.size() << "-zone network in " << solveMs << " ms" << std::endl;
+    }
+    return 0;
+}
+
+// 단일 방의 3D 농도장을 적분하며 평균/최대/최소 농도와 완전 혼합 모델 값 출력
+static int runField(const CliScenario& sc, int resolution, float tEnd, float dt, const std::string& outputFile, unsigned threads) {
+    ModelParams params = toParams(sc);
+    std::vector<FieldOpening> openings = ConcentrationField::defaultOpenings(sc.room);
+    if (!sc.openings.empty()) openings = loadedScenario(sc).fieldOpenings(); // 불러온 시나리오의 실제 개구부 형상 사용
+    ThreadPool pool(threads);
+    ConcentrationField field;
+    field.setThreadPool(&pool);
+    auto begin = std::chrono::steady_clock::now();
+    field.configure(sc.room.width, sc.room.depth, sc.room.height, resolution, openings);
+    field.setParameters(params.S, ConcentrationField::bulkDecay(params.K, params.V, openings));
+    field.reset(params.C0);
+    auto configured = std::chrono::steady_clock::now();
+
+    std::ofstream outFile;
+    if (!outputFile.empty()) {
+        outFile.open(outputFile);
+        if (!outFile.is_open()) { std::cerr << "Error: Could not open output file: " << outputFile << std::endl; return 1; }
+    }
+    std::ostream& out = outputFile.empty() ? std::cout : outFile;
+    out << "t,mean,max,min,well_mixed\n" << std::fixed << std::setprecision(4);
+
+    BatchEngine timeline(tEnd, dt); // 샘플 시간 계산만 재사용
+    float previous = 0.f;
+    for (std::size_t s = 0; s < timeline.samplesPerScenario(); ++s) {
+        float t = timeline.sampleTime(s);
+        field.advance(t - previous);
+        previous = t;
+        out << t << ',' << field.mean() << ',' << field.maxValue() << ',' << field.minValue() << ','
+            << ConcentrationModel::concentrationAt(params, t) << '\n';
+    }
+    out.flush();
+    auto end = std::chrono::steady_clock::now();
+
+    double setupMs = std::chrono::duration<double, std::milli>(configured - begin).count();
+    double stepMs = std::chrono::duration<double, std::milli>(end - configured).count();
+    std::cerr << "Field " << field.nx() << "x" << field.ny() << "x" << field.nz() << ": setup " << setupMs << " ms, "
+              << tEnd << " min in " << stepMs << " ms (internal dt " << field.stableStep() << " min, "
+              << pool.size() << " threads)" << std::endl;
+    return 0;
+}
+
+// 벡터화 커널 검증: 무작위 입력에 대해 각 구현의 결과를 기존 스칼라 모델(std::exp)과 비교
+// 오차는 max(|C0|, S/(kV))로 정규화 (C가 0 근처일 때 상대 오차가 무의미해지는 것 방지)
+static int runKernelCheck() {
+    const std::size_t n = 1 << 20; // 검증 원소 수
+    const float tolerance = TrajectoryKernel::EXP_REL_ERROR_BOUND; // 정규화 오차 허용치 (근사 exp의 상대 오차 한계)
+    std::mt19937 gen(12345);       // 재현 가능한 고정 시드
+    std::uniform_real_distribution<float> distT(0.f, 1440.f), distC0(0.f, 500.f), distS(0.f, 100.f),
+                                          distK(ConcentrationModel::MIN_K, 0.5f), distV(1.f, 500.f);
+    std::vector<float> t(n), C0(n), S(n), K(n), V(n), ref(n), out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        t[i] = distT(gen); C0[i] = distC0(gen); S[i] = distS(gen); K[i] = distK(gen); V[i] = distV(gen);
+        ref[i] = ConcentrationModel::concentrationAt({C0[i], S[i], K[i], V[i]}, t[i]); // 기존 스칼라 계산
+    }
+
+    bool ok = true;
+    const TrajectoryKernel::Isa isas[] = {TrajectoryKernel::Isa::Scalar, TrajectoryKernel::Isa::SSE2, TrajectoryKernel::Isa::AVX2};
+    for (TrajectoryKernel::Isa isa : isas) {
+        if (!TrajectoryKernel::isaSupported(isa)) continue;
+        auto begin = std::chrono::steady_clock::now();
+        TrajectoryKernel::evaluateWith(isa, t.data(), C0.data(), S.data(), K.data(), V.data(), out.data(), n);
+        auto end = std::chrono::steady_clock::now();
+        float maxError = 0.f;
+        for (std::size_t i = 0; i < n; ++i) {
+            float css = ConcentrationModel::steadyState({C0[i], S[i], K[i], V[i]});
+            float scale = std::max({std::fabs(C0[i]), css, 1e-6f});
+            maxError = std::max(maxError, std::fabs(out[i] - ref[i]) / scale);
+        }
+        double ns = std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(n);
+        std::cout << TrajectoryKernel::isaName(isa) << (isa == TrajectoryKernel::activeIsa() ? " (active)" : "")
+                  << ": max normalized error " << maxError << ", " << ns << " ns/element" << std::endl;
+        if (!(maxError <= tolerance)) ok = false;
+
+        // 근사 exp 범위 위쪽 끝: 제한 범위 안은 허용 오차 이내, 밖은 유한한 최댓값으로 제한 (inf가 되지 않음)
+        // (K = -1, S = 0이면 C = C0·exp(t), 벡터 경로를 타도록 16개)
+        const float edges[] = {80.f, 87.5f, 88.f, 88.02f, 88.5f, 100.f, 1000.f};
+        std::vector<float> et(16), eC0(16, 1.f), eS(16, 0.f), eK(16, -1.f), eV(16, 1.f), eOut(16);
+        for (float x : edges) {
+            std::fill(et.begin(), et.end(), x);
+            TrajectoryKernel::evaluateWith(isa, et.data(), eC0.data(), eS.data(), eK.data(), eV.data(), eOut.data(), et.size());
+            float expected = std::exp(std::min(x, 88.02f));
+            for (float value : eOut) {
+                if (!std::isfinite(value) || std::fabs(value - expected) / expected > tolerance) {
+                    std::cout << TrajectoryKernel::isaName(isa) << ": exp(" << x << ") edge gives " << value << " (expected " << expected << ")" << std::endl;
+                    ok = false;
+                    break;
+                }
+            }
+        }
+    }
+    std::cout << (ok ? "Kernel check passed" : "Kernel check FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
+
+// Philox 알려진 답 벡터와 일괄 생성 경로 검증 후 일괄 생성 처리량 출력
+static int runRngCheck() {
+    bool ok = Philox::selfTest();
+    const std::size_t n = 1 << 20; // 측정 카운터 수
+    std::vector<std::uint32_t> word1(n, 0u);
+    std::vector<float> out0(n), out1(n), out2(n), out3(n);
+    auto begin = std::chrono::steady_clock::now();
+    Philox::uniformBatch({12345u, 0u}, 0u, word1.data(), 0u, 0u, out0.data(), out1.data(), out2.data(), out3.data(), n);
+    auto end = std::chrono::steady_clock::now();
+    double mean = 0.0;
+    for (std::size_t i = 0; i < n; ++i) mean += out0[i] + out1[i] + out2[i] + out3[i];
+    mean /= static_cast<double>(4 * n);
+    double ns = std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(4 * n);
+    std::cout << "philox4x32-10 " << Philox::activeIsaName() << ": mean " << mean << ", " << ns << " ns/number" << std::endl;
+    if (std::fabs(mean - 0.5) > 1e-3) ok = false; // 균등 분포 평균 확인
+    std::cout << (ok ? "RNG check passed" : "RNG check FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
+
+// 시계열 기록 왕복 검증: 여러 블록 분량의 표본을 바이너리와 CSV로 기록한 뒤 다시 읽어 비트 단위로 비교하고,
+// 블록 표본 수가 잘못된 파일(할당 전에 거부해야 함)을 읽기가 거부하는지 확인
+static int runRecorderCheck() {
+    const std::size_t n = 3 * TimeSeriesRecorder::BLOCK_SAMPLES + 17; // 마지막 블록은 일부만 참
+    std::vector<RecordSample> samples(n);
+    for (std::size_t i = 0; i < n; ++i) { // 최단 표현이 긴 값과 0, 음수, 큰 정수를 섞음
+        double t = static_cast<double>(i) / 3.0;
+        samples[i] = {t, static_cast<float>(100.0 * std::exp(-0.05 * t)), i % 7 == 0 ? 0.f : 10.f / 3.f,
+                      -static_cast<float>(i) * 1e-7f, static_cast<std::uint32_t>(i * 2654435761u), static_cast<std::uint32_t>(i / 1000)};
+    }
+    auto same = [](const RecordSample& a, const RecordSample& b) {
+        return std::memcmp(&a.t, &b.t, sizeof(double)) == 0 && std::memcmp(&a.C, &b.C, sizeof(float)) == 0 &&
+               std::memcmp(&a.S, &b.S, sizeof(float)) == 0 && std::memcmp(&a.K, &b.K, sizeof(float)) == 0 &&
+               a.particles == b.particles && a.series == b.series;
+    };
+    auto write = [&](const std::string& path, TimeSeriesRecorder::Format format) {
+        TimeSeriesRecorder recorder;
+        if (!recorder.start(path, format, TimeSeriesRecorder::Overflow::Wait)) return false;
+        for (std::size_t i = 0; i < n; i += 1000) recorder.recordBatch(samples.data() + i, std::min<std::size_t>(1000, n - i));
+        recorder.stop();
+        return recorder.writtenCount() == n;
+    };
+    std::filesystem::path dir = std::filesystem::temp_directory_path();
+    std::string binaryPath = (dir / "iaps_check_recording.rec").string(), csvPath = (dir / "iaps_check_recording.csv").string();
+    bool ok = true;
+
+    std::vector<RecordSample> loaded;
+    bool binaryOk = write(binaryPath, TimeSeriesRecorder::Format::Binary) && TimeSeriesRecorder::readBinary(binaryPath, loaded) &&
+                    loaded.size() == n && std::equal(samples.begin(), samples.end(), loaded.begin(), same);
+    std::cout << "binary round trip (" << n << " samples): " << (binaryOk ? "ok" : "MISMATCH") << std::endl;
+    ok = ok && binaryOk;
+
+    bool csvOk = write(csvPath, TimeSeriesRecorder::Format::Csv);
+    std::ifstream csv(csvPath);
+    std::string line;
+    std::size_t rows = 0;
+    csvOk = csvOk && std::getline(csv, line) && line == "t,C,S,K,particles,series";
+    while (csvOk && std::getline(csv, line)) {
+        RecordSample s;
+        const char* p = line.data();
+        const char* end = p + line.size();
+        auto field = [&](auto& value) { // 값 하나를 읽고 구분자를 건너뜀
+            auto result = std::from_chars(p, end, value);
+            bool parsed = result.ec == std::errc() && (result.ptr == end || *result.ptr == ',');
+            p = result.ptr + (result.ptr != end);
+            return parsed;
+        };
+        csvOk = field(s.t) && field(s.C) && field(s.S) && field(s.K) && field(s.particles) && field(s.series) &&
+                rows < n && same(s, samples[rows]);
+        ++rows;
+    }
+    csvOk = csvOk && rows == n;
+    std::cout << "csv round trip (" << n << " samples): " << (csvOk ? "ok" : "MISMATCH") << std::endl;
+    ok = ok && csvOk;
+
+    { // 블록 머리글의 표본 수를 0xFFFFFFFF로 바꾼 파일
+        std::fstream corrupt(binaryPath, std::ios::in | std::ios::out | std::ios::binary);
+        const std::uint32_t count = 0xFFFFFFFFu;
+        corrupt.seekp(16); // 파일 머리글 다음 첫 블록
+        corrupt.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    std::cout << "corrupt block count (expect an error below):" << std::endl;
+    bool rejected = !TimeSeriesRecorder::readBinary(binaryPath, loaded);
+    std::cout << "corrupt block count: " << (rejected ? "rejected" : "ACCEPTED") << std::endl;
+    ok = ok && rejected;
+
+    std::filesystem::remove(binaryPath);
+    std::filesystem::remove(csvPath);
+    std::cout << (ok ? "Recorder check passed" : "Recorder check FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    CliScenario single;        // 명령줄 옵션으로 지정한 단일 시나리오
+    std::string scenarioFile;  // 시나리오 파일 경로 (지정 시 단일 시나리오 대신 사용)
+    std::string outputFile;    // 출력 파일 경로 (비어 있으면 표준 출력)
+    std::string recordFile;    // 시계열 기록 파일 경로 (비어 있으면 기록 안 함)
+    float tEnd = 60.0f, dt = 1.0f; // 시간 구간 기본값 (분)
+    bool sweepMode = false;        // 스윕 모드 여부
+    SweepGrid grid;                // 스윕 격자 (지정하지 않은 축은 단일 시나리오 값 사용)
+    SweepOptions sweepOptions{50.0f, {60.0f}}; // 임계값 및 기록 시간 기본값
+    unsigned threads = 0;          // 스윕 스레드 수 (0: 자동)
+    std::string format = "csv";    // 스윕 출력 형식
+    std::string zoneFile;          // 다중 구역 네트워크 파일
+    std::string convertFile;       // --zones 텍스트 파일을 변환해 저장할 바이너리 평면도 경로
+    bool sparseZones = false;      // 희소 Krylov 해석기 사용 여부
+    std::size_t partitions = 0;    // 구역 그래프 분할 수 (0: 스레드 수)
+    int fieldResolution = 0;       // 3D 농도장 해상도 (0: 사용 안 함)
+
+    // 명령줄 인자 파싱
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") { printUsage(); return 0; }
+        if (arg == "--sweep") { sweepMode = true; continue; } // 값이 없는 플래그
+        if (arg == "--sparse") { sparseZones = true; continue; }
+        if (arg == "--check-kernel") return runKernelCheck();
+        if (arg == "--check-rng") return runRngCheck();
+        if (arg == "--check-recorder") return runRecorderCheck();
+        if (i + 1 >= argc) { std::cerr << "Error: Missing value for " << arg << std::endl; printUsage(); return 1; }
+        std::string value = argv[++i];
+        try {
+            if (arg == "--width") single.room.width = std::stof(value);
+            else if (arg == "--depth") single.room.depth = std::stof(value);
+            else if (arg == "--height") single.room.height = std::stof(value);
+            else if (arg == "--pollutant") single.room.pollutantIndex = parsePollutant(value);
+            else if (arg == "--passages") single.room.numPassages = std::stoi(value);
+            else if (arg == "--windows") single.room.numWindows = std::stoi(value);
+            else if (arg == "--c0") single.C0 = std::stof(value);
+            else if (arg == "--load") {
+                Scenario scenario;
+                if (!scenario.loadFromFile(value)) return 1;
+                single.room = scenario.roomConfig();
+                single.openings = scenario.openings;
+                single.mesh = scenario.mesh;
+            }
+            else if (arg == "--mesh") {
+                auto mesh = std::make_shared<RoomMesh>();
+                if (!mesh->loadFromFile(value)) return 1;
+                single.room.width = mesh->width(); single.room.depth = mesh->depth(); single.room.height = mesh->height();
+                std::cerr << "Loaded room mesh " << value << ": " << mesh->triangleCount() << " triangles, "
+                          << mesh->outlineEdges().size() << " outline edges, volume " << mesh->volume() << " m^3 ("
+                          << mesh->fillFraction() * 100.f << "% of bounding box)" << std::endl;
+                single.mesh = std::move(mesh);
+            }
+            else if (arg == "--s") { single.S = std::stof(value); single.hasS = true; }
+            else if (arg == "--k") { single.K = std::stof(value); single.hasK = true; }
+            else if (arg == "--t-end") tEnd = std::stof(value);
+            else if (arg == "--dt") dt = std::stof(value);
+            else if (arg == "--scenarios") scenarioFile = value;
+            else if (arg == "--output") outputFile = value;
+            else if (arg == "--record") recordFile = value;
+            else if (arg == "--grid-c0" || arg == "--grid-s" || arg == "--grid-k" || arg == "--grid-volume") {
+                std::vector<float>& axis = (arg == "--grid-c0") ? grid.C0 : (arg == "--grid-s") ? grid.S : (arg == "--grid-k") ? grid.K : grid.volume;
+                if (!parseAxis(value, axis)) { std::cerr << "Error: Invalid grid for " << arg << ": " << value << std::endl; return 1; }
+            }
+            else if (arg == "--grid-passages" || arg == "--grid-windows") {
+                if (!parseIntAxis(value, arg == "--grid-passages" ? grid.passages : grid.windows)) { std::cerr << "Error: Invalid grid for " << arg << ": " << value << std::endl; return 1; }
+            }
+            else if (arg == "--threshold") sweepOptions.threshold = std::stof(value);
+            else if (arg == "--at") { if (!parseAxis(value, sweepOptions.sampleTimes)) { std::cerr << "Error: Invalid time list: " << value << std::endl; return 1; } }
+            else if (arg == "--threads") threads = static_cast<unsigned>(std::stoi(value));
+            else if (arg == "--format") format = value;
+            else if (arg == "--zones") zoneFile = value;
+            else if (arg == "--convert") convertFile = value;
+            else if (arg == "--field") fieldResolution = std::stoi(value);
+            else if (arg == "--partitions") partitions = static_cast<std::size_t>(std::stoul(value));
+            else { std::cerr << "Error: Unknown option " << arg << std::endl; printUsage(); return 1; }
+        } catch (const std::exception& e) { // stof/stoi 변환 실패
+            std::cerr << "Error: Invalid value for " << arg << ": " << value << " (" << e.what() << ")" << std::endl;
+            return 1;
+        }
+    }
+    if (single.room.pollutantIndex < 0 || single.room.pollutantIndex > 2) {
+        std::cerr << "Error: Unknown pollutant" << std::endl;
+        return 1;
+    }
+
+    if (fieldResolution > 0) return runField(single, fieldResolution, tEnd, dt, outputFile, threads);
+    if (!convertFile.empty()) {
+        if (zoneFile.empty()) { std::cerr << "Error: --convert needs --zones FILE" << std::endl; return 1; }
+        return runConvert(zoneFile, convertFile);
+    }
+    if (!zoneFile.empty()) return runZones(zoneFile, tEnd, dt, outputFile, sparseZones, threads, partitions);
+
+    if (sweepMode) {
+        // 지정하지 않은 축은 단일 시나리오 값(밀폐 상태 기준 S, K)으로 채움
+        float baseS = 0.f, baseK = 0.f;
+        ConcentrationModel::defaultSK(single.room.pollutantIndex, 0, 0, baseS, baseK);
+        if (grid.C0.empty()) grid.C0.push_back(single.C0);
+        if (grid.S.empty()) grid.S.push_back(single.hasS ? single.S : baseS);
+        if (grid.K.empty()) grid.K.push_back(single.hasK ? single.K : baseK);
+        if (grid.volume.empty()) grid.volume.push_back(loadedScenario(single).volume());
+        if (grid.passages.empty()) grid.passages.push_back(single.room.numPassages);
+        if (grid.windows.empty()) grid.windows.push_back(single.room.numWindows);
+        return runSweep(grid, sweepOptions, threads, format, outputFile);
+    }
+
+    // 평가할 시나리오 목록 구성
+    std::vector<ModelParams> scenarios;
+    if (!scenarioFile.empty()) {
+        std::ifstream inFile(scenarioFile);
+        if (!inFile.is_open()) {
+            std::cerr << "Error: Could not open scenario file: " << scenarioFile << std::endl;
+            return 1;
+        }
+        std::string line; int lineNo = 0;
+        while (std::getline(inFile, line)) {
+            ++lineNo;
+            if (line.empty() || line[0] == '#') continue; // 빈 줄 및 주석 무시
+            CliScenario sc;
+            if (!parseScenarioLine(line, sc)) {
+                std::cerr << "Warning: Skipping invalid scenario line " << lineNo << ": " << line << std::endl;
+                continue;
+            }
+            if (sc.room.pollutantIndex < 0 || sc.room.pollutantIndex > 2) { // --pollutant와 같은 기준
+                std::cerr << "Error: Unknown pollutant on scenario line " << lineNo << ": " << line << std::endl;
+                return 1;
+            }
+            scenarios.push_back(toParams(sc));
+        }
+    } else {
+        scenarios.push_back(toParams(single));
+    }
+
+    // 배치 평가 (--record: 궤적 하나를 계산할 때마다 표본을 BLOCK_SAMPLES개씩 묶어 기록기 큐에 넣고,
+    // 파일 쓰기는 기록기 스레드가 나머지 시나리오 계산과 겹쳐 처리. Wait 정책이라 표본을 버리지 않음)
+    BatchEngine engine(tEnd, dt);
+    std::vector<float> trajectories;
+    TimeSeriesRecorder recorder;
+    std::vector<RecordSample> recordBatch;
+    BatchEngine::ScenarioCallback record;
+    if (!recordFile.empty()) {
+        if (!recorder.start(recordFile, TimeSeriesRecorder::formatFor(recordFile), TimeSeriesRecorder::Overflow::Wait)) return 1;
+        recordBatch.reserve(TimeSeriesRecorder::BLOCK_SAMPLES);
+        record = [&](std::size_t s, const float* trajectory) { // 계열 번호 = 시나리오 인덱스
+            for (std::size_t i = 0; i < engine.samplesPerScenario(); ++i) {
+                recordBatch.push_back({engine.sampleTime(i), trajectory[i], scenarios[s].S, scenarios[s].K, 0, static_cast<std::uint32_t>(s)});
+                if (recordBatch.size() == TimeSeriesRecorder::BLOCK_SAMPLES) {
+                    recorder.recordBatch(recordBatch.data(), recordBatch.size());
+                    recordBatch.clear();
+                }
+            }
+        };
+    }
+    auto begin = std::chrono::steady_clock::now();
+    engine.run(scenarios, trajectories, record);
+    auto end = std::chrono::steady_clock::now();
+    if (recorder.recording()) {
+        recorder.recordBatch(recordBatch.data(), recordBatch.size());
+        recorder.stop(); // 큐에 남은 표본까지 쓰고 닫음
+        double recordMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        std::cerr << "Recorded " << recorder.writtenCount() << " samples to " << recordFile << " in " << recordMs << " ms ("
+                  << recorder.writtenCount() / std::max(recordMs * 1e-3, 1e-9) / 1e6 << " M samples/s)" << std::endl;
+    }
+
+    // 결과 출력 (scenario,t,C 형식의 CSV)
+    std::ofstream outFile;
+    if (!outputFile.empty()) {
+        outFile.open(outputFile);
+        if (!outFile.is_open()) {
+            std::cerr << "Error: Could not open output file: " << outputFile << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = outputFile.empty() ? std::cout : outFile;
+    out << "scenario,t,concentration\n";
+    out << std::fixed << std::setprecision(4);
+    std::size_t samples = engine.samplesPerScenario();
+    for (std::size_t s = 0; s < scenarios.size(); ++s) {
+        for (std::size_t i = 0; i < samples; ++i) {
+            out << s << ',' << engine.sampleTime(i) << ',' << trajectories[s * samples + i] << '\n';
+        }
+    }
+    out.flush();
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(end - begin).count();
+    std::cerr << "Evaluated " << scenarios.size() << " scenarios x " << samples << " samples in " << elapsedMs << " ms" << std::endl;
+    return 0;
+}
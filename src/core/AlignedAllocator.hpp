@@ -0,0 +1,26 @@
+#ifndef ALIGNED_ALLOCATOR_HPP
+#define ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+// 배열 시작 주소를 Alignment 바이트 경계에 맞추는 할당자
+// SIMD 루프가 캐시 라인/벡터 레지스터 경계에서 시작하도록 해 정렬되지 않은 앞부분 처리를 없앰
+template <typename T, std::size_t Alignment = 64>
+struct AlignedAllocator {
+    using value_type = T;
+    template <typename U> struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    AlignedAllocator() noexcept = default;
+    template <typename U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, std::align_val_t(Alignment)); }
+
+    template <typename U> bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    template <typename U> bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+#endif
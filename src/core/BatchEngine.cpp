@@ -0,0 +1,31 @@
+#include "BatchEngine.hpp"
+#include "TrajectoryKernel.hpp"
+#include <cmath>
+
+// BatchEngine 생성자: 시간 구간 및 샘플 간격 설정
+BatchEngine::BatchEngine(float tEnd, float dt)
+    : m_tEnd(tEnd > 0.f ? tEnd : 0.f), // 음수 시간 구간 방지
+      m_dt(dt > 1e-6f ? dt : 1.0f) {   // 0 또는 음수 간격이면 1분 사용
+    // 끝점 포함 샘플 수 (부동소수점 오차로 끝점이 빠지지 않도록 약간의 여유)
+    m_numSamples = static_cast<std::size_t>(std::floor(m_tEnd / m_dt + 1e-4f)) + 1;
+    m_times.resize(m_numSamples);
+    for (std::size_t i = 0; i < m_numSamples; ++i) m_times[i] = sampleTime(i);
+}
+
+std::size_t BatchEngine::samplesPerScenario() const { return m_numSamples; }
+
+float BatchEngine::sampleTime(std::size_t i) const { return static_cast<float>(i) * m_dt; }
+
+// 단일 시나리오 궤적 계산 (벡터화 커널 사용, 음수 농도는 커널에서 0으로 보정)
+void BatchEngine::evaluate(const ModelParams& params, float* out) const {
+    TrajectoryKernel::evaluateTrajectory(params, m_times.data(), out, m_numSamples);
+}
+
+// 여러 시나리오 궤적 계산 (결과는 [시나리오][샘플] 순서의 평탄화된 배열)
+void BatchEngine::run(const std::vector<ModelParams>& scenarios, std::vector<float>& out, const ScenarioCallback& onScenario) const {
+    out.resize(scenarios.size() * m_numSamples);
+    for (std::size_t s = 0; s < scenarios.size(); ++s) {
+        evaluate(scenarios[s], out.data() + s * m_numSamples);
+        if (onScenario) onScenario(s, out.data() + s * m_numSamples);
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef BATCH_ENGINE_HPP
+#define BATCH_ENGINE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include "Model.hpp"
+
+// 여러 시나리오의 농도 궤적 C(t)를 한 번에 계산하는 헤드리스 배치 엔진
+// GUI 루프와 무관하게 시간 구간 [0, tEnd]를 dt 간격으로 샘플링함
+class BatchEngine {
+public:
+    // 생성자: 시간 구간 끝(분)과 샘플 간격(분)
+    BatchEngine(float tEnd, float dt);
+
+    // 시나리오 1개당 샘플 수 (t = 0, dt, 2dt, ..., tEnd)
+    std::size_t samplesPerScenario() const;
+    // i번째 샘플의 시간 t (분)
+    float sampleTime(std::size_t i) const;
+
+    // 단일 시나리오의 궤적을 out 배열에 기록 (out은 samplesPerScenario() 크기 이상이어야 함)
+    void evaluate(const ModelParams& params, float* out) const;
+    // 시나리오 하나의 궤적을 계산할 때마다 호출 (시나리오 인덱스, 그 궤적 samplesPerScenario()개)
+    using ScenarioCallback = std::function<void(std::size_t scenario, const float* trajectory)>;
+
+    // 여러 시나리오의 궤적을 시나리오 순서대로 이어붙여 out에 기록 (onScenario가 있으면 궤적마다 바로 넘김)
+    void run(const std::vector<ModelParams>& scenarios, std::vector<float>& out, const ScenarioCallback& onScenario = nullptr) const;
+
+private:
+    float m_tEnd;             // 시간 구간 끝 (분)
+    float m_dt;               // 샘플 간격 (분)
+    std::size_t m_numSamples; // 시나리오당 샘플 수
+    std::vector<float> m_times; // 샘플 시간 배열 (모든 시나리오가 공유, 벡터화 커널 입력)
+};
+
+#endif
@@ -0,0 +1,482 @@
+#include "ConcentrationField.hpp"
+#include "ZoneNetwork.hpp"
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <iostream>
+
+const int ConcentrationField::DEFAULT_RESOLUTION = 64;
+// 약 0.003 m²/s: 환기가 약한 실내의 난류 확산 계수
+const float ConcentrationField::DIFFUSIVITY = 0.18f;
+const float ConcentrationField::CFL_SAFETY = 0.9f;
+// BLOCK_Y 행 × 3개 z 평면이 L1/L2 캐시에 들어가는 크기
+const int ConcentrationField::BLOCK_Y = 16;
+// 타일(32행 × 16평면)과 halo의 상태 및 계수 배열이 L2/L3 캐시에 머무는 크기
+// 256³ 격자에서 타일이 128개라 32개 코어에 고르게 나누어짐
+// 단계를 더 묶으면 halo 중복 계산이 메모리 절약보다 커짐 (단일 코어 측정 기준 2가 최적)
+const int ConcentrationField::TILE_Y = 32;
+const int ConcentrationField::TILE_Z = 16;
+const int ConcentrationField::TEMPORAL_BLOCK = 2;
+// SimulationScreen의 WINDOW_RELATIVE_*_FACTOR_SIM과 동일
+const float ConcentrationField::WINDOW_HEIGHT_FACTOR = 0.5f;
+const float ConcentrationField::WINDOW_WIDTH_FACTOR = 0.4f;
+
+ConcentrationField::ConcentrationField()
+    : m_pool(nullptr), m_nx(0), m_ny(0), m_nz(0), m_sx(0), m_sxy(0), m_hx(1.f), m_hy(1.f), m_hz(1.f),
+      m_volume(1.f), m_source(0.f), m_bulkK(ConcentrationModel::MIN_K), m_stableDt(1.f),
+      m_mean(0.f), m_max(0.f), m_min(0.f) {}
+
+int ConcentrationField::nx() const { return m_nx; }
+int ConcentrationField::ny() const { return m_ny; }
+int ConcentrationField::nz() const { return m_nz; }
+float ConcentrationField::mean() const { return m_mean; }
+float ConcentrationField::maxValue() const { return m_max; }
+float ConcentrationField::minValue() const { return m_min; }
+float ConcentrationField::stableStep() const { return m_stableDt; }
+std::size_t ConcentrationField::cellCount() const { return static_cast<std::size_t>(m_nx) * m_ny * m_nz; }
+float ConcentrationField::cell(int i, int j, int k) const { return m_current[index(i, j, k)]; }
+
+void ConcentrationField::setThreadPool(ThreadPool* pool) { m_pool = pool; }
+
+std::size_t ConcentrationField::index(int i, int j, int k) const {
+    return static_cast<std::size_t>(i + 1) + m_sx * static_cast<std::size_t>(j + 1) + m_sxy * static_cast<std::size_t>(k + 1);
+}
+
+template <typename Buffer>
+void ConcentrationField::fillGhosts(Buffer& field) const {
+    for (int k = 0; k < m_nz; ++k) { // x 방향 벽 (왼쪽/오른쪽)
+        for (int j = 0; j < m_ny; ++j) {
+            std::size_t first = index(0, j, k), last = index(m_nx - 1, j, k);
+            field[first - 1] = field[first];
+            field[last + 1] = field[last];
+        }
+    }
+    for (int k = 0; k < m_nz; ++k) { // y 방향 벽 (바닥/천장)
+        for (int i = 0; i < m_nx; ++i) {
+            std::size_t first = index(i, 0, k), last = index(i, m_ny - 1, k);
+            field[first - m_sx] = field[first];
+            field[last + m_sx] = field[last];
+        }
+    }
+    for (int j = 0; j < m_ny; ++j) { // z 방향 벽 (앞/뒤)
+        for (int i = 0; i < m_nx; ++i) {
+            std::size_t first = index(i, j, 0), last = index(i, j, m_nz - 1);
+            field[first - m_sxy] = field[first];
+            field[last + m_sxy] = field[last];
+        }
+    }
+}
+
+// 작업자 수만큼 연속 구간으로 나누어 body(begin, end) 실행 (풀이 없으면 호출 스레드에서 한 번에)
+// 같은 count에는 항상 같은 분할이 나오므로, 첫 접근과 적분에서 작업자별로 비슷한 z 구간을 맡게 됨
+// (작업 훔치기 때문에 스레드-구간 대응은 보장되지 않는 최선 노력)
+template <typename Body>
+void ConcentrationField::forEachChunk(std::size_t count, const Body& body) {
+    if (count == 0) return;
+    if (!m_pool || m_pool->size() <= 1) { body(std::size_t(0), count); return; }
+    std::size_t grain = (count + m_pool->size() - 1) / m_pool->size();
+    m_pool->parallelFor(0, count, grain, [&body](std::size_t begin, std::size_t end) { body(begin, end); });
+}
+
+void ConcentrationField::allocateBuffers(std::size_t total) {
+    FieldBuffer* buffers[] = {&m_current, &m_next, &m_ux, &m_uy, &m_uz, &m_boundarySink, &m_decay};
+    for (FieldBuffer* buffer : buffers) *buffer = FieldBuffer(total); // 새로 할당만 하고 값은 쓰지 않음
+    std::size_t planes = static_cast<std::size_t>(m_nz + 2);
+    forEachChunk(planes, [&](std::size_t begin, std::size_t end) {
+        for (FieldBuffer* buffer : buffers) {
+            std::fill(buffer->begin() + begin * m_sxy, buffer->begin() + end * m_sxy, 0.f);
+        }
+    });
+}
+
+void ConcentrationField::configure(float width, float depth, float height, int resolution, const std::vector<FieldOpening>& openings) {
+    width = std::max(width, 0.01f); depth = std::max(depth, 0.01f); height = std::max(height, 0.01f); // 0 크기 방지
+    float maxDim = std::max({width, depth, height});
+    float cellsPerMeter = static_cast<float>(std::max(resolution, 4)) / maxDim;
+    m_nx = std::max(4, static_cast<int>(std::lround(width * cellsPerMeter)));
+    m_ny = std::max(4, static_cast<int>(std::lround(height * cellsPerMeter)));
+    m_nz = std::max(4, static_cast<int>(std::lround(depth * cellsPerMeter)));
+    m_hx = width / m_nx; m_hy = height / m_ny; m_hz = depth / m_nz;
+    m_volume = ConcentrationModel::roomVolume({width, depth, height, 0, 0, 0});
+    m_sx = static_cast<std::size_t>(m_nx + 2);
+    m_sxy = m_sx * static_cast<std::size_t>(m_ny + 2);
+    allocateBuffers(m_sxy * static_cast<std::size_t>(m_nz + 2));
+
+    // 개구부 사각형을 벽면 셀로 래스터화
+    const int counts[3] = {m_nx, m_ny, m_nz};
+    const float spacings[3] = {m_hx, m_hy, m_hz};
+    std::vector<std::vector<BoundaryFace>> faces;
+    std::vector<FieldOpening> validOpenings;
+    for (const FieldOpening& opening : openings) {
+        const Vec3D* c = opening.localCoords.data();
+        auto coord = [&](int v, int axis) { return axis == 0 ? c[v].x : (axis == 1 ? c[v].y : c[v].z); };
+        int normal = -1; // 개구부가 놓인 벽면의 법선 축
+        for (int axis = 0; axis < 3 && normal < 0; ++axis) {
+            bool onWall = true;
+            for (int v = 0; v < 4; ++v) onWall = onWall && std::fabs(std::fabs(coord(v, axis)) - 0.5f) < 1e-4f && coord(v, axis) * coord(0, axis) > 0.f;
+            if (onWall) normal = axis;
+        }
+        if (normal < 0) { std::cerr << "Warning: Opening is not on a wall face. Skipping." << std::endl; continue; }
+        int side = coord(0, normal) > 0.f ? 1 : -1;
+        int u = (normal + 1) % 3, w = (normal + 2) % 3; // 벽면 내 두 축
+        float uMin = 1.f, uMax = -1.f, wMin = 1.f, wMax = -1.f;
+        for (int v = 0; v < 4; ++v) {
+            uMin = std::min(uMin, coord(v, u)); uMax = std::max(uMax, coord(v, u));
+            wMin = std::min(wMin, coord(v, w)); wMax = std::max(wMax, coord(v, w));
+        }
+        auto cellRange = [&](int axis, float lo, float hi, int& first, int& last) {
+            // 셀 중심이 [lo, hi]에 드는 셀 범위 (없으면 가운데에서 가장 가까운 셀 1개)
+            first = static_cast<int>(std::ceil((lo + 0.5f) * counts[axis] - 0.5f));
+            last = static_cast<int>(std::floor((hi + 0.5f) * counts[axis] - 0.5f));
+            first = std::max(first, 0); last = std::min(last, counts[axis] - 1);
+            if (first > last) {
+                first = last = std::clamp(static_cast<int>(((lo + hi) * 0.5f + 0.5f) * counts[axis]), 0, counts[axis] - 1);
+            }
+        };
+        int uFirst, uLast, wFirst, wLast;
+        cellRange(u, uMin, uMax, uFirst, uLast);
+        cellRange(w, wMin, wMax, wFirst, wLast);
+        std::vector<BoundaryFace> openingFaces;
+        for (int a = uFirst; a <= uLast; ++a) {
+            for (int b = wFirst; b <= wLast; ++b) {
+                int ijk[3];
+                ijk[normal] = (side > 0) ? counts[normal] - 1 : 0;
+                ijk[u] = a; ijk[w] = b;
+                std::size_t cell = index(ijk[0], ijk[1], ijk[2]);
+                std::size_t stride = (normal == 0) ? 1 : (normal == 1 ? m_sx : m_sxy);
+                std::size_t ghost = (side > 0) ? cell + stride : cell - stride;
+                openingFaces.push_back({cell, ghost, spacings[normal], spacings[u] * spacings[w]});
+            }
+        }
+        faces.push_back(openingFaces);
+        validOpenings.push_back(opening);
+    }
+
+    if (validOpenings.size() >= 2) {
+        solveFlow(faces, validOpenings); // 관통 유동
+    } else if (validOpenings.size() == 1) {
+        // 개구부 1개: 면 전체에서 외부(농도 0)와 교환, 교환 속도 = 풍량 / 면적
+        float area = 0.f;
+        for (const BoundaryFace& f : faces[0]) area += f.area;
+        float exchangeVelocity = validOpenings[0].flow / area;
+        for (const BoundaryFace& f : faces[0]) m_boundarySink[f.cell] += exchangeVelocity / f.spacing;
+    }
+    setParameters(m_source, m_bulkK); // 제거율 배열 및 안정 시간 간격 갱신
+}
+
+// 라플라스 방정식 ∇²φ = 0 을 적흑(red-black) SOR로 풀어 유속 u = -∇φ 구성
+void ConcentrationField::solveFlow(const std::vector<std::vector<BoundaryFace>>& faces, const std::vector<FieldOpening>& openings) {
+    const int MAX_ITERATIONS = 5000; // 최대 반복 횟수 (보통 수백 회 이내 수렴)
+    const double TOLERANCE = 1e-7;   // 반복당 최대 변화량 수렴 기준
+    const std::ptrdiff_t sx = static_cast<std::ptrdiff_t>(m_sx), sxy = static_cast<std::ptrdiff_t>(m_sxy);
+    std::vector<double> phi(m_current.size(), 0.5); // float로는 반올림 오차 때문에 수렴 기준에 도달하지 못함
+    const double wx = 1.0 / (m_hx * m_hx), wy = 1.0 / (m_hy * m_hy), wz = 1.0 / (m_hz * m_hz);
+    const double invDiag = 1.0 / (2.0 * (wx + wy + wz));
+    const double omega = 2.0 / (1.0 + std::sin(3.14159265358979 / static_cast<double>(std::max({m_nx, m_ny, m_nz}))));
+
+    // 벽은 ∂φ/∂n = 0, 개구부 면은 φ_면 = (φ_셀 + φ_유령)/2 가 유입구 1, 유출구 0이 되도록 유령 셀 설정
+    auto applyBoundary = [&]() {
+        fillGhosts(phi);
+        for (std::size_t o = 0; o < faces.size(); ++o) {
+            double value = (o == 0) ? 1.0 : 0.0;
+            for (const BoundaryFace& f : faces[o]) phi[f.ghost] = 2.0 * value - phi[f.cell];
+        }
+    };
+    int iteration = 0;
+    for (; iteration < MAX_ITERATIONS; ++iteration) {
+        double maxChange = 0.0;
+        for (int color = 0; color < 2; ++color) {
+            applyBoundary();
+            for (int k = 0; k < m_nz; ++k) {
+                for (int j = 0; j < m_ny; ++j) {
+                    double* p = phi.data() + index(0, j, k);
+                    for (int i = (j + k + color) & 1; i < m_nx; i += 2) {
+                        double gs = (wx * (p[i - 1] + p[i + 1]) + wy * (p[i - sx] + p[i + sx]) + wz * (p[i - sxy] + p[i + sxy])) * invDiag;
+                        double change = gs - p[i];
+                        p[i] += omega * change;
+                        maxChange = std::max(maxChange, std::fabs(change));
+                    }
+                }
+            }
+        }
+        if (maxChange < TOLERANCE) break;
+    }
+    if (iteration == MAX_ITERATIONS) std::cerr << "Warning: Opening flow field did not fully converge." << std::endl;
+    applyBoundary();
+
+    // 내부 면 유속 (벽면은 0 유지)
+    for (int k = 0; k < m_nz; ++k) {
+        for (int j = 0; j < m_ny; ++j) {
+            for (int i = 0; i < m_nx; ++i) {
+                std::size_t idx = index(i, j, k);
+                if (i > 0) m_ux[idx] = static_cast<float>(-(phi[idx] - phi[idx - 1]) / m_hx);
+                if (j > 0) m_uy[idx] = static_cast<float>(-(phi[idx] - phi[idx - m_sx]) / m_hy);
+                if (k > 0) m_uz[idx] = static_cast<float>(-(phi[idx] - phi[idx - m_sxy]) / m_hz);
+            }
+        }
+    }
+
+    // 유입구 통과 풍량이 개구부 풍량 합과 같아지도록 크기 조정
+    double totalFlow = 0.0, rawInflow = 0.0;
+    for (const FieldOpening& o : openings) totalFlow += o.flow;
+    for (const BoundaryFace& f : faces[0]) rawInflow += (phi[f.ghost] - phi[f.cell]) / f.spacing * f.area;
+    if (rawInflow <= 0.0) return;
+    float scale = static_cast<float>(totalFlow / rawInflow);
+    for (std::size_t i = 0; i < m_ux.size(); ++i) { m_ux[i] *= scale; m_uy[i] *= scale; m_uz[i] *= scale; }
+
+    // 벽면 개구부의 유출은 셀별 제거율로 처리 (유입 공기 농도는 0이므로 유입 면은 희석만 일으킴)
+    for (const std::vector<BoundaryFace>& openingFaces : faces) {
+        for (const BoundaryFace& f : openingFaces) {
+            float outward = static_cast<float>((phi[f.cell] - phi[f.ghost]) / f.spacing) * scale; // 바깥 방향 유속
+            if (outward > 0.f) m_boundarySink[f.cell] += outward / f.spacing;
+        }
+    }
+}
+
+void ConcentrationField::setParameters(float S, float bulkK) {
+    m_source = S;
+    m_bulkK = std::max(bulkK, ConcentrationModel::MIN_K);
+    for (std::size_t i = 0; i < m_decay.size(); ++i) m_decay[i] = m_bulkK + m_boundarySink[i];
+    updateStableStep();
+}
+
+// 양해법 양수 보존 조건: 1 - dt · (확산 + 유출 + 제거율) ≥ 0
+void ConcentrationField::updateStableStep() {
+    const float diffusionRate = 2.f * DIFFUSIVITY * (1.f / (m_hx * m_hx) + 1.f / (m_hy * m_hy) + 1.f / (m_hz * m_hz));
+    float maxRate = diffusionRate;
+    for (int k = 0; k < m_nz; ++k) {
+        for (int j = 0; j < m_ny; ++j) {
+            for (int i = 0; i < m_nx; ++i) {
+                std::size_t idx = index(i, j, k);
+                float outflow = (std::max(m_ux[idx + 1], 0.f) + std::max(-m_ux[idx], 0.f)) / m_hx
+                              + (std::max(m_uy[idx + m_sx], 0.f) + std::max(-m_uy[idx], 0.f)) / m_hy
+                              + (std::max(m_uz[idx + m_sxy], 0.f) + std::max(-m_uz[idx], 0.f)) / m_hz;
+                maxRate = std::max(maxRate, diffusionRate + outflow + m_decay[idx]);
+            }
+        }
+    }
+    m_stableDt = CFL_SAFETY / maxRate;
+}
+
+void ConcentrationField::reset(float C0) {
+    std::fill(m_current.begin(), m_current.end(), C0);
+    std::fill(m_next.begin(), m_next.end(), C0);
+    updateStatistics();
+}
+
+void ConcentrationField::advance(float dt) {
+    if (m_nx == 0 || dt <= 0.f) return;
+    int steps = static_cast<int>(std::ceil(dt / m_stableDt));
+    runSteps(steps, dt / static_cast<float>(steps));
+    updateStatistics();
+}
+
+void ConcentrationField::advanceSteps(int steps) {
+    if (m_nx == 0 || steps <= 0) return;
+    runSteps(steps, m_stableDt);
+    updateStatistics();
+}
+
+// 풀이 있으면 TEMPORAL_BLOCK 단계씩 타일 병렬로, 없으면 단일 스레드 블로킹 경로로 진행
+void ConcentrationField::runSteps(int steps, float dt) {
+    if (!m_pool) {
+        for (int s = 0; s < steps; ++s) step(dt);
+        return;
+    }
+    for (int done = 0; done < steps; done += TEMPORAL_BLOCK) blockedSteps(std::min(TEMPORAL_BLOCK, steps - done), dt);
+}
+
+// 한 단계 갱신에 필요한 상수 묶음
+struct StencilCoefficients {
+    float ax, ay, az, diag; // D/h² 및 중심 계수 2(ax + ay + az)
+    float ihx, ihy, ihz;    // 1/h
+    float source;           // 셀당 유입 S/V
+    float dt;               // 시간 간격
+};
+
+static StencilCoefficients makeCoefficients(float hx, float hy, float hz, float diffusivity, float source, float dt) {
+    StencilCoefficients coeffs;
+    coeffs.ax = diffusivity / (hx * hx); coeffs.ay = diffusivity / (hy * hy); coeffs.az = diffusivity / (hz * hz);
+    coeffs.diag = 2.f * (coeffs.ax + coeffs.ay + coeffs.az);
+    coeffs.ihx = 1.f / hx; coeffs.ihy = 1.f / hy; coeffs.ihz = 1.f / hz;
+    coeffs.source = source;
+    coeffs.dt = dt;
+    return coeffs;
+}
+
+// x 한 행 갱신 (이웃 행/평면마다 포인터를 따로 받아 모든 접근이 연속 i 접근이 되도록 함)
+// 분기 없는 upwind 유속: F = max(u,0)·C_앞 + min(u,0)·C_뒤
+static void updateRow(const float* __restrict c, const float* __restrict cS, const float* __restrict cN,
+               const float* __restrict cB, const float* __restrict cF,
+               const float* __restrict ux, const float* __restrict uyS, const float* __restrict uyN,
+               const float* __restrict uzB, const float* __restrict uzF,
+               const float* __restrict decay, float* __restrict out, int nx, const StencilCoefficients& k) {
+    const float ax = k.ax, ay = k.ay, az = k.az, diag = k.diag;
+    const float ihx = k.ihx, ihy = k.ihy, ihz = k.ihz, source = k.source, dt = k.dt;
+    for (int i = 0; i < nx; ++i) {
+        float cc = c[i];
+        float laplacian = ax * (c[i - 1] + c[i + 1]) + ay * (cS[i] + cN[i]) + az * (cB[i] + cF[i]) - diag * cc;
+        float fw = std::max(ux[i], 0.f) * c[i - 1] + std::min(ux[i], 0.f) * cc;
+        float fe = std::max(ux[i + 1], 0.f) * cc + std::min(ux[i + 1], 0.f) * c[i + 1];
+        float fs = std::max(uyS[i], 0.f) * cS[i] + std::min(uyS[i], 0.f) * cc;
+        float fn = std::max(uyN[i], 0.f) * cc + std::min(uyN[i], 0.f) * cN[i];
+        float fb = std::max(uzB[i], 0.f) * cB[i] + std::min(uzB[i], 0.f) * cc;
+        float ff = std::max(uzF[i], 0.f) * cc + std::min(uzF[i], 0.f) * cF[i];
+        float divergence = (fe - fw) * ihx + (fn - fs) * ihy + (ff - fb) * ihz;
+        out[i] = cc + dt * (laplacian - divergence + source - decay[i] * cc);
+    }
+}
+
+// 양해법 한 단계: y 블록마다 z 평면을 차례로 훑어 블록의 세 평면이 캐시에 머무르게 함
+void ConcentrationField::step(float dt) {
+    fillGhosts(m_current);
+    const std::ptrdiff_t sx = static_cast<std::ptrdiff_t>(m_sx), sxy = static_cast<std::ptrdiff_t>(m_sxy);
+    const StencilCoefficients coeffs = makeCoefficients(m_hx, m_hy, m_hz, DIFFUSIVITY, m_source / m_volume, dt);
+    const int nx = m_nx;
+
+    for (int jBlock = 0; jBlock < m_ny; jBlock += BLOCK_Y) {
+        int jEnd = std::min(jBlock + BLOCK_Y, m_ny);
+        for (int k = 0; k < m_nz; ++k) {
+            for (int j = jBlock; j < jEnd; ++j) {
+                std::size_t row = index(0, j, k);
+                const float* c = m_current.data() + row;
+                const float* uy = m_uy.data() + row;
+                const float* uz = m_uz.data() + row;
+                updateRow(c, c - sx, c + sx, c - sxy, c + sxy, m_ux.data() + row, uy, uy + sx, uz, uz + sxy,
+                          m_decay.data() + row, m_next.data() + row, nx, coeffs);
+            }
+        }
+    }
+    m_current.swap(m_next);
+}
+
+// 중첩 시간 블로킹: (y, z) 타일마다 steps칸 halo를 포함한 영역을 스레드 지역 버퍼로 복사한 뒤
+// 단계 s에서는 타일을 (steps - 1 - s)칸 넓힌 영역만 계산해, 마지막 단계에서 타일 내부가 정확해지도록 함
+// 계산 순서와 연산이 step()과 같으므로 결과도 비트 단위로 같음
+void ConcentrationField::blockedSteps(int steps, float dt) {
+    const StencilCoefficients coeffs = makeCoefficients(m_hx, m_hy, m_hz, DIFFUSIVITY, m_source / m_volume, dt);
+    const int nx = m_nx, ny = m_ny, nz = m_nz;
+    const int tilesY = (ny + TILE_Y - 1) / TILE_Y, tilesZ = (nz + TILE_Z - 1) / TILE_Z;
+    const std::size_t sx = m_sx;
+
+    forEachChunk(static_cast<std::size_t>(tilesY) * tilesZ, [&](std::size_t tileBegin, std::size_t tileEnd) {
+        thread_local std::vector<float> bufferA, bufferB; // 타일 지역 상태 (작업자별로 재사용)
+        for (std::size_t tile = tileBegin; tile < tileEnd; ++tile) {
+            const int tj0 = static_cast<int>(tile % tilesY) * TILE_Y, tj1 = std::min(tj0 + TILE_Y, ny);
+            const int tk0 = static_cast<int>(tile / tilesY) * TILE_Z, tk1 = std::min(tk0 + TILE_Z, nz);
+            // 지역 버퍼 범위: halo steps칸, 벽 쪽은 유령 셀 한 겹까지
+            const int lj0 = std::max(tj0 - steps, -1), lj1 = std::min(tj1 + steps, ny + 1);
+            const int lk0 = std::max(tk0 - steps, -1), lk1 = std::min(tk1 + steps, nz + 1);
+            const std::size_t lsxy = sx * static_cast<std::size_t>(lj1 - lj0);
+            const std::ptrdiff_t psx = static_cast<std::ptrdiff_t>(sx), psxy = static_cast<std::ptrdiff_t>(lsxy);
+            auto local = [&](int j, int k) { return sx * static_cast<std::size_t>(j - lj0) + lsxy * static_cast<std::size_t>(k - lk0) + 1; };
+            std::size_t size = lsxy * static_cast<std::size_t>(lk1 - lk0);
+            if (bufferA.size() < size) { bufferA.resize(size); bufferB.resize(size); }
+            float* a = bufferA.data();
+            float* b = bufferB.data();
+            for (int k = lk0; k < lk1; ++k) {
+                for (int j = lj0; j < lj1; ++j) {
+                    const float* src = m_current.data() + index(-1, j, k);
+                    std::copy(src, src + sx, a + local(j, k) - 1);
+                }
+            }
+
+            for (int s = 0; s < steps; ++s) {
+                const int grow = steps - 1 - s;
+                const int cj0 = std::max(tj0 - grow, 0), cj1 = std::min(tj1 + grow, ny);
+                const int ck0 = std::max(tk0 - grow, 0), ck1 = std::min(tk1 + grow, nz);
+                // 계산 영역이 벽에 닿는 곳의 유령 셀 갱신 (∂C/∂n = 0)
+                for (int k = ck0; k < ck1; ++k) {
+                    for (int j = cj0; j < cj1; ++j) {
+                        float* row = a + local(j, k);
+                        row[-1] = row[0];
+                        row[nx] = row[nx - 1];
+                    }
+                    if (cj0 == 0) std::copy(a + local(0, k), a + local(0, k) + nx, a + local(-1, k));
+                    if (cj1 == ny) std::copy(a + local(ny - 1, k), a + local(ny - 1, k) + nx, a + local(ny, k));
+                }
+                for (int j = cj0; j < cj1; ++j) {
+                    if (ck0 == 0) std::copy(a + local(j, 0), a + local(j, 0) + nx, a + local(j, -1));
+                    if (ck1 == nz) std::copy(a + local(j, nz - 1), a + local(j, nz - 1) + nx, a + local(j, nz));
+                }
+                for (int k = ck0; k < ck1; ++k) {
+                    for (int j = cj0; j < cj1; ++j) {
+                        std::size_t row = index(0, j, k);
+                        const float* c = a + local(j, k);
+                        const float* uy = m_uy.data() + row;
+                        const float* uz = m_uz.data() + row;
+                        updateRow(c, c - psx, c + psx, c - psxy, c + psxy, m_ux.data() + row, uy, uy + sx, uz, uz + m_sxy,
+                                  m_decay.data() + row, b + local(j, k), nx, coeffs);
+                    }
+                }
+                std::swap(a, b);
+            }
+
+            for (int k = tk0; k < tk1; ++k) {
+                for (int j = tj0; j < tj1; ++j) std::copy(a + local(j, k), a + local(j, k) + nx, m_next.data() + index(0, j, k));
+            }
+        }
+    });
+    m_current.swap(m_next);
+}
+
+// z 평면별 부분합을 고정 순서로 더해 결과가 스레드 수와 무관하게 함
+void ConcentrationField::updateStatistics() {
+    std::vector<double> planeSum(static_cast<std::size_t>(m_nz), 0.0);
+    std::vector<float> planeMax(planeSum.size(), 0.f), planeMin(planeSum.size(), 0.f);
+    forEachChunk(planeSum.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; ++k) {
+            double sum = 0.0;
+            float maxValue = m_current[index(0, 0, static_cast<int>(k))], minValue = maxValue;
+            for (int j = 0; j < m_ny; ++j) {
+                const float* c = m_current.data() + index(0, j, static_cast<int>(k));
+                for (int i = 0; i < m_nx; ++i) {
+                    sum += c[i];
+                    maxValue = std::max(maxValue, c[i]);
+                    minValue = std::min(minValue, c[i]);
+                }
+            }
+            planeSum[k] = sum; planeMax[k] = maxValue; planeMin[k] = minValue;
+        }
+    });
+    double sum = 0.0;
+    float maxValue = planeSum.empty() ? 0.f : planeMax[0], minValue = planeSum.empty() ? 0.f : planeMin[0];
+    for (std::size_t k = 0; k < planeSum.size(); ++k) {
+        sum += planeSum[k];
+        maxValue = std::max(maxValue, planeMax[k]);
+        minValue = std::min(minValue, planeMin[k]);
+    }
+    std::size_t cells = cellCount();
+    m_mean = cells ? static_cast<float>(sum / static_cast<double>(cells)) : 0.f;
+    m_max = maxValue;
+    m_min = minValue;
+}
+
+float ConcentrationField::sample(const Vec3D& local) const {
+    if (m_nx == 0) return 0.f;
+    int i = std::clamp(static_cast<int>((local.x + 0.5f) * m_nx), 0, m_nx - 1);
+    int j = std::clamp(static_cast<int>((local.y + 0.5f) * m_ny), 0, m_ny - 1);
+    int k = std::clamp(static_cast<int>((local.z + 0.5f) * m_nz), 0, m_nz - 1);
+    return m_current[index(i, j, k)];
+}
+
+// 창문을 먼저 나열 (첫 번째 개구부가 외부 공기 유입구가 됨)
+std::vector<FieldOpening> ConcentrationField::defaultOpenings(const RoomConfig& room) {
+    std::vector<FieldOpening> openings;
+    float volume = ConcentrationModel::roomVolume(room);
+    float wh = WINDOW_HEIGHT_FACTOR * 0.5f, wd = WINDOW_WIDTH_FACTOR * 0.5f;
+    float ph = ZoneNetwork::DEFAULT_PASSAGE_HEIGHT_FACTOR * 0.5f, pw = ZoneNetwork::DEFAULT_PASSAGE_WIDTH_FACTOR * 0.5f;
+    float windowFlow = ConcentrationModel::K_ADJUST_WINDOW * volume;
+    float passageFlow = ConcentrationModel::K_ADJUST_PASSAGE * volume;
+    if (room.numWindows >= 1) openings.push_back({{{{-0.5f, -wh, -wd}, {-0.5f, -wh, wd}, {-0.5f, wh, wd}, {-0.5f, wh, -wd}}}, windowFlow}); // 왼쪽 면
+    if (room.numWindows >= 2) openings.push_back({{{{0.5f, -wh, -wd}, {0.5f, -wh, wd}, {0.5f, wh, wd}, {0.5f, wh, -wd}}}, windowFlow});     // 오른쪽 면
+    if (room.numPassages >= 1) openings.push_back({{{{-pw, -ph, -0.5f}, {pw, -ph, -0.5f}, {pw, ph, -0.5f}, {-pw, ph, -0.5f}}}, passageFlow}); // 앞면
+    if (room.numPassages >= 2) openings.push_back({{{{-pw, -ph, 0.5f}, {pw, -ph, 0.5f}, {pw, ph, 0.5f}, {-pw, ph, 0.5f}}}, passageFlow});     // 뒷면
+    return openings;
+}
+
+float ConcentrationField::bulkDecay(float totalK, float volume, const std::vector<FieldOpening>& openings) {
+    float openingK = 0.f;
+    for (const FieldOpening& o : openings) openingK += o.flow / std::max(volume, ConcentrationModel::MIN_VOLUME);
+    return std::max(totalK - openingK, ConcentrationModel::MIN_K);
+}
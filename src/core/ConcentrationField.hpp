@@ -0,0 +1,112 @@
+#ifndef CONCENTRATION_FIELD_HPP
+#define CONCENTRATION_FIELD_HPP
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include "Geometry.hpp"
+#include "Model.hpp"
+#include "ThreadPool.hpp"
+#include "UninitializedAllocator.hpp"
+
+// 개구부(통로/창문) 하나의 경계 정보
+struct FieldOpening {
+    std::array<Vec3D, 4> localCoords; // 네 꼭짓점의 정규화 로컬 좌표 (-0.5 ~ 0.5, 한 축은 ±0.5인 벽면)
+    float flow;                       // 이 개구부의 환기 풍량 (m³/min, 완전 혼합 모델의 K 조정량 × V)
+};
+
+// 방 내부의 3D 복셀 격자 농도장 (이류-확산 방정식)
+// ∂C/∂t = D∇²C - ∇·(uC) + S/V - k_bulk C
+// - 개구부가 2개 이상이면 첫 번째 개구부로 외부 공기(농도 0)가 들어와 나머지로 빠져나가는
+//   퍼텐셜 유동 u = -∇φ 를 구성 시 한 번 풀어 사용 (유입구 φ = 1, 유출구 φ = 0, 벽은 ∂φ/∂n = 0)
+// - 개구부가 1개면 그 면에서 외부와 농도 차에 비례해 교환
+// 총 풍량은 개구부 풍량의 합이므로, 잘 섞인 극한에서 평균 농도는 ConcentrationModel과 같은 K로 감소함
+// 시간 적분은 양해법(upwind 이류 + 7점 확산)이며, z축을 따라 y 블록 단위로 훑어 캐시에 머무르게 하고
+// 가장 안쪽 x 루프는 분기 없이 작성해 컴파일러가 SIMD로 벡터화함
+// 스레드 풀을 지정하면 (y, z) 타일을 작업자들이 나누어 맡고, 타일마다 이웃 TEMPORAL_BLOCK칸의 halo를
+// 스레드 지역 버퍼로 복사해 여러 단계를 한 번에 진행함 (중첩 시간 블로킹: halo를 중복 계산하는 대신
+// 전체 격자를 메모리에서 읽고 쓰는 횟수를 TEMPORAL_BLOCK분의 1로 줄임, 결과는 단일 스레드와 비트 단위로 같음)
+class ConcentrationField {
+public:
+    ConcentrationField();
+
+    // 병렬 적분에 사용할 스레드 풀 (nullptr이면 단일 스레드)
+    // configure() 전에 지정하면 격자 배열도 작업자들이 z 구간별로 처음 접근(first-touch)해 할당함
+    void setThreadPool(ThreadPool* pool);
+
+    // 격자 구성: 방 크기(m), 가장 긴 축의 셀 수, 개구부 목록 (퍼텐셜 유동 계산 포함)
+    void configure(float width, float depth, float height, int resolution, const std::vector<FieldOpening>& openings);
+    // 오염원 총 유입 속도 S와 개구부를 제외한 벌크 제거 상수 설정
+    void setParameters(float S, float bulkK);
+    // 모든 셀을 농도 C0으로 초기화
+    void reset(float C0);
+    // dt(분)만큼 시간 전진 (안정 조건을 만족하도록 내부적으로 나누어 적분)
+    void advance(float dt);
+    // 안정 시간 간격으로 정확히 steps 단계 진행 (벤치마크용)
+    void advanceSteps(int steps);
+
+    // 정규화 로컬 좌표(-0.5 ~ 0.5)의 농도 (가장 가까운 셀 값)
+    float sample(const Vec3D& local) const;
+    float mean() const;     // 평균 농도
+    float maxValue() const; // 최대 농도 (국소 고농도 지점)
+    float minValue() const; // 최소 농도
+    int nx() const; int ny() const; int nz() const; // 축별 셀 수 (x: 너비, y: 높이, z: 깊이)
+    float stableStep() const; // 안정 조건을 만족하는 최대 내부 시간 간격 (분)
+    std::size_t cellCount() const; // 내부 셀 수
+    float cell(int i, int j, int k) const; // 내부 셀 (0-기반) 농도
+
+    // SimulationScreen의 통로/창문 배치(앞/뒤 통로, 왼쪽/오른쪽 창문)와 같은 기본 개구부 목록
+    static std::vector<FieldOpening> defaultOpenings(const RoomConfig& room);
+    // 전체 K에서 개구부 환기분을 뺀 벌크 제거 상수 (MIN_K 이상)
+    static float bulkDecay(float totalK, float volume, const std::vector<FieldOpening>& openings);
+
+    static const int DEFAULT_RESOLUTION;       // 기본 격자 해상도 (가장 긴 축 셀 수)
+    static const float DIFFUSIVITY;            // 실내 난류 확산 계수 (m²/min)
+    static const float CFL_SAFETY;             // 안정 시간 간격에 곱하는 안전 계수
+    static const int BLOCK_Y;                  // 캐시 블로킹 y 블록 크기 (행 수, 단일 스레드)
+    static const int TILE_Y;                   // 병렬 타일 y 크기 (행 수)
+    static const int TILE_Z;                   // 병렬 타일 z 크기 (평면 수)
+    static const int TEMPORAL_BLOCK;           // 타일 하나에서 한 번에 진행하는 시간 단계 수
+    static const float WINDOW_HEIGHT_FACTOR;   // 기본 창문 높이 비율 (SimulationScreen과 동일)
+    static const float WINDOW_WIDTH_FACTOR;    // 기본 창문 너비 비율 (SimulationScreen과 동일)
+
+private:
+    // 개구부 경계면의 셀 하나
+    struct BoundaryFace {
+        std::size_t cell;  // 경계 셀 인덱스 (패딩 포함)
+        std::size_t ghost; // 벽 밖 유령 셀 인덱스
+        float spacing;     // 벽에 수직인 축의 셀 간격
+        float area;        // 면 넓이
+    };
+
+    // 첫 접근 전에는 값을 채우지 않는 격자 배열
+    using FieldBuffer = std::vector<float, UninitializedAllocator<float>>;
+
+    ThreadPool* m_pool;                 // 병렬 적분용 스레드 풀 (nullptr이면 단일 스레드)
+    int m_nx, m_ny, m_nz;               // 축별 내부 셀 수
+    std::size_t m_sx, m_sxy;            // 패딩 포함 x 행 길이, xy 평면 크기 (인덱스 보폭)
+    float m_hx, m_hy, m_hz;             // 축별 셀 간격 (m)
+    float m_volume;                     // 방 부피 (m³)
+    float m_source;                     // 오염원 총 유입 속도 S
+    float m_bulkK;                      // 벌크 제거 상수
+    float m_stableDt;                   // 안정 시간 간격 (분)
+    FieldBuffer m_current;              // 현재 농도 (유령 셀 한 겹 패딩, x가 가장 빠른 축)
+    FieldBuffer m_next;                 // 다음 단계 농도
+    FieldBuffer m_ux, m_uy, m_uz;       // 셀 앞쪽 면(i-1|i 등)의 유속 (m/min, 벽면은 0)
+    FieldBuffer m_boundarySink;         // 개구부 유출/교환에 의한 셀별 추가 제거율 (1/min)
+    FieldBuffer m_decay;                // 셀별 총 제거율 = k_bulk + m_boundarySink
+    float m_mean, m_max, m_min;         // 마지막 전진 후 통계
+
+    std::size_t index(int i, int j, int k) const; // 내부 셀 (0-기반) → 패딩 포함 인덱스
+    void solveFlow(const std::vector<std::vector<BoundaryFace>>& faces, const std::vector<FieldOpening>& openings);
+    void updateStableStep();
+    template <typename Buffer> void fillGhosts(Buffer& field) const; // 벽면 유령 셀을 인접 내부 셀 값으로 복사 (∂/∂n = 0)
+    void allocateBuffers(std::size_t total); // 배열 할당 후 작업자들이 z 평면 구간별로 0을 써서 첫 접근
+    template <typename Body> void forEachChunk(std::size_t count, const Body& body); // [0, count)를 작업자 수만큼 연속 구간으로 나누어 실행
+    void runSteps(int steps, float dt);  // 단일 스레드 또는 시간 블로킹 병렬 경로 선택
+    void step(float dt);                 // 단일 스레드 한 단계
+    void blockedSteps(int steps, float dt); // 타일별로 steps 단계를 한 번에 진행 (steps ≤ TEMPORAL_BLOCK)
+    void updateStatistics();
+};
+
+#endif
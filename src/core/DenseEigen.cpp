@@ -0,0 +1,57 @@
+#include "DenseEigen.hpp"
+#include <cmath>
+
+// 대칭 행렬 고유값 분해 (순환 Jacobi)
+bool symmetricEigen(std::size_t n, std::vector<double>& a,
+                    std::vector<double>& eigenvalues, std::vector<double>& eigenvectors) {
+    const int MAX_SWEEPS = 100; // 최대 순환 횟수 (보통 10회 이내 수렴)
+    eigenvectors.assign(n * n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) eigenvectors[i * n + i] = 1.0; // 단위 행렬에서 시작
+
+    bool converged = false;
+    for (int sweep = 0; sweep < MAX_SWEEPS; ++sweep) {
+        // 비대각 원소 제곱합과 전체 크기 비교로 수렴 판정
+        double offDiag = 0.0, total = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                double v = a[i * n + j] * a[i * n + j];
+                total += v;
+                if (i != j) offDiag += v;
+            }
+        }
+        if (offDiag <= 1e-26 * total || offDiag == 0.0) { converged = true; break; }
+
+        for (std::size_t p = 0; p + 1 < n; ++p) {
+            for (std::size_t q = p + 1; q < n; ++q) {
+                double apq = a[p * n + q];
+                if (std::fabs(apq) < 1e-300) continue;
+                // a[p][q]를 0으로 만드는 회전 각도 계산
+                double theta = (a[q * n + q] - a[p * n + p]) / (2.0 * apq);
+                double t = (theta >= 0.0 ? 1.0 : -1.0) / (std::fabs(theta) + std::sqrt(theta * theta + 1.0));
+                double c = 1.0 / std::sqrt(t * t + 1.0);
+                double s = t * c;
+                // A <- Jᵀ A J (p, q 행/열만 변경)
+                for (std::size_t k = 0; k < n; ++k) {
+                    double akp = a[k * n + p], akq = a[k * n + q];
+                    a[k * n + p] = c * akp - s * akq;
+                    a[k * n + q] = s * akp + c * akq;
+                }
+                for (std::size_t k = 0; k < n; ++k) {
+                    double apk = a[p * n + k], aqk = a[q * n + k];
+                    a[p * n + k] = c * apk - s * aqk;
+                    a[q * n + k] = s * apk + c * aqk;
+                }
+                // 고유벡터 누적: V <- V J
+                for (std::size_t k = 0; k < n; ++k) {
+                    double vkp = eigenvectors[k * n + p], vkq = eigenvectors[k * n + q];
+                    eigenvectors[k * n + p] = c * vkp - s * vkq;
+                    eigenvectors[k * n + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    eigenvalues.resize(n);
+    for (std::size_t i = 0; i < n; ++i) eigenvalues[i] = a[i * n + i];
+    return converged;
+}
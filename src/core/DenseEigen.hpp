@@ -0,0 +1,15 @@
+#ifndef DENSE_EIGEN_HPP
+#define DENSE_EIGEN_HPP
+
+#include <vector>
+#include <cstddef>
+
+// 대칭 행렬 고유값 분해 (순환 Jacobi 회전법)
+// matrix: n x n 행 우선(row-major) 대칭 행렬 (계산 중 덮어씀)
+// eigenvalues: 고유값 n개
+// eigenvectors: n x n 행 우선, j번째 열이 j번째 고유벡터 (정규직교)
+// 수렴하지 못하면 false 반환 (결과는 마지막 반복 상태)
+bool symmetricEigen(std::size_t n, std::vector<double>& matrix,
+                    std::vector<double>& eigenvalues, std::vector<double>& eigenvectors);
+
+#endif
@@ -0,0 +1,205 @@
+#include "FloorplanFile.hpp"
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const std::uint32_t FloorplanFile::FORMAT_VERSION = 1;
+
+static const char MAGIC[8] = {'I', 'A', 'P', 'S', 'F', 'L', 'R', '\0'};
+static const std::uint32_t SECTION_ROOMS = 1;    // FloorplanRoom 배열
+static const std::uint32_t SECTION_OPENINGS = 2; // FloorplanOpening 배열
+
+// 파일 앞부분 (필드는 모두 자연 정렬이라 패딩 없음)
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t sectionCount;
+    std::uint64_t fileSize;
+};
+// 구획 표 항목
+struct SectionEntry {
+    std::uint32_t kind;
+    std::uint32_t recordSize;
+    std::uint64_t offset;
+    std::uint64_t count;
+};
+static_assert(sizeof(FileHeader) == 24 && sizeof(SectionEntry) == 24, "file layout");
+
+// 레코드를 그대로 쓰고 읽으므로 리틀 엔디언 CPU에서만 지원
+static bool littleEndianHost() { return std::endian::native == std::endian::little; }
+
+static std::uint64_t alignUp(std::uint64_t value) { return (value + 7) & ~std::uint64_t(7); }
+
+FloorplanFile::FloorplanFile()
+    : m_data(nullptr), m_size(0), m_mapped(false), m_rooms(nullptr), m_roomCount(0), m_openings(nullptr), m_openingCount(0) {}
+
+FloorplanFile::~FloorplanFile() { close(); }
+
+void FloorplanFile::close() {
+#if !defined(_WIN32)
+    if (m_mapped && m_data) munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_rooms = nullptr; m_roomCount = 0;
+    m_openings = nullptr; m_openingCount = 0;
+}
+
+bool FloorplanFile::open(const std::string& filename) {
+    close();
+    if (!littleEndianHost()) {
+        std::cerr << "Error: Binary floorplan files are only supported on little-endian hosts" << std::endl;
+        return false;
+    }
+#if !defined(_WIN32)
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error: Could not open floorplan file: " << filename << std::endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        std::cerr << "Error: Empty or unreadable floorplan file: " << filename << std::endl;
+        return false;
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+    void* mapped = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // 매핑은 파일 설명자를 닫아도 유지됨
+    if (mapped == MAP_FAILED) {
+        m_size = 0;
+        std::cerr << "Error: Could not map floorplan file: " << filename << std::endl;
+        return false;
+    }
+    m_data = static_cast<const unsigned char*>(mapped);
+    m_mapped = true;
+#else
+    std::ifstream inFile(filename, std::ios::binary | std::ios::ate);
+    if (!inFile.is_open()) {
+        std::cerr << "Error: Could not open floorplan file: " << filename << std::endl;
+        return false;
+    }
+    m_buffer.resize(static_cast<std::size_t>(inFile.tellg()));
+    inFile.seekg(0);
+    if (m_buffer.empty() || !inFile.read(reinterpret_cast<char*>(m_buffer.data()), m_buffer.size())) {
+        std::cerr << "Error: Empty or unreadable floorplan file: " << filename << std::endl;
+        m_buffer.clear();
+        return false;
+    }
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#endif
+    if (!validate(filename)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+// 헤더, 구획 표, 각 구획 범위만 검사 (레코드 값은 ZoneNetwork::addFloorplan이 구역을 만들기 전에 검사)
+bool FloorplanFile::validate(const std::string& filename) {
+    FileHeader header;
+    if (m_size < sizeof(header)) {
+        std::cerr << "Error: Not a floorplan file: " << filename << std::endl;
+        return false;
+    }
+    std::memcpy(&header, m_data, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        std::cerr << "Error: Not a floorplan file: " << filename << std::endl;
+        return false;
+    }
+    if (header.version == 0 || header.version > FORMAT_VERSION) {
+        std::cerr << "Error: Floorplan file version " << header.version << " is not supported (latest "
+                  << FORMAT_VERSION << "): " << filename << std::endl;
+        return false;
+    }
+    std::uint64_t tableEnd = sizeof(header) + std::uint64_t(header.sectionCount) * sizeof(SectionEntry);
+    if (header.fileSize != m_size || tableEnd > m_size) {
+        std::cerr << "Error: Truncated or corrupt floorplan file: " << filename << std::endl;
+        return false;
+    }
+    for (std::uint32_t s = 0; s < header.sectionCount; ++s) {
+        SectionEntry entry;
+        std::memcpy(&entry, m_data + sizeof(header) + s * sizeof(SectionEntry), sizeof(entry));
+        std::size_t expected = entry.kind == SECTION_ROOMS ? sizeof(FloorplanRoom)
+                             : entry.kind == SECTION_OPENINGS ? sizeof(FloorplanOpening) : 0;
+        if (expected == 0) continue; // 이후 버전의 구획
+        if (entry.recordSize != expected || entry.offset % 8 != 0 || entry.offset < tableEnd || entry.offset > m_size ||
+            entry.count > (m_size - entry.offset) / expected) {
+            std::cerr << "Error: Invalid section " << entry.kind << " in floorplan file: " << filename << std::endl;
+            return false;
+        }
+        if (entry.kind == SECTION_ROOMS) {
+            m_rooms = reinterpret_cast<const FloorplanRoom*>(m_data + entry.offset);
+            m_roomCount = static_cast<std::size_t>(entry.count);
+        } else {
+            m_openings = reinterpret_cast<const FloorplanOpening*>(m_data + entry.offset);
+            m_openingCount = static_cast<std::size_t>(entry.count);
+        }
+    }
+    return true;
+}
+
+const FloorplanRoom* FloorplanFile::rooms() const { return m_rooms; }
+std::size_t FloorplanFile::roomCount() const { return m_roomCount; }
+const FloorplanOpening* FloorplanFile::openings() const { return m_openings; }
+std::size_t FloorplanFile::openingCount() const { return m_openingCount; }
+
+bool FloorplanFile::write(const std::string& filename, const std::vector<FloorplanRoom>& rooms, const std::vector<FloorplanOpening>& openings) {
+    if (!littleEndianHost()) {
+        std::cerr << "Error: Binary floorplan files are only supported on little-endian hosts" << std::endl;
+        return false;
+    }
+    std::ofstream outFile(filename, std::ios::binary);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Could not open file to save floorplan: " << filename << std::endl;
+        return false;
+    }
+    const std::uint32_t sectionCount = 2;
+    std::uint64_t roomsOffset = alignUp(sizeof(FileHeader) + sectionCount * sizeof(SectionEntry));
+    std::uint64_t openingsOffset = alignUp(roomsOffset + rooms.size() * sizeof(FloorplanRoom));
+    std::uint64_t fileSize = openingsOffset + openings.size() * sizeof(FloorplanOpening);
+
+    FileHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.sectionCount = sectionCount;
+    header.fileSize = fileSize;
+    const SectionEntry table[2] = {
+        {SECTION_ROOMS, sizeof(FloorplanRoom), roomsOffset, rooms.size()},
+        {SECTION_OPENINGS, sizeof(FloorplanOpening), openingsOffset, openings.size()},
+    };
+    const char padding[8] = {};
+    std::uint64_t position = 0;
+    auto put = [&](const void* data, std::uint64_t bytes) {
+        outFile.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        position += bytes;
+    };
+    put(&header, sizeof(header));
+    put(table, sizeof(table));
+    put(padding, roomsOffset - position);
+    put(rooms.data(), rooms.size() * sizeof(FloorplanRoom));
+    put(padding, openingsOffset - position);
+    put(openings.data(), openings.size() * sizeof(FloorplanOpening));
+    if (!outFile) {
+        std::cerr << "Error: Could not write floorplan file: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool FloorplanFile::isFloorplanFile(const std::string& filename) {
+    std::ifstream inFile(filename, std::ios::binary);
+    char magic[sizeof(MAGIC)] = {};
+    return inFile.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
@@ -0,0 +1,69 @@
+#ifndef FLOORPLAN_FILE_HPP
+#define FLOORPLAN_FILE_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// 건물 평면도의 방 하나 (구역 네트워크 텍스트 파일의 zone 줄과 같은 값, 파일에 그대로 저장되는 24바이트 레코드)
+struct FloorplanRoom {
+    float width, depth, height; // 방 크기 (m)
+    float C0;                   // 초기 농도
+    std::int32_t pollutantIndex; // 오염물질 인덱스 (S, K는 오염물질/창문 기본값)
+    std::int32_t numWindows;     // 창문 개수
+};
+
+// 두 방 사이 개구부 하나 (link/passage 줄을 풍량으로 환산한 값, 16바이트 레코드)
+struct FloorplanOpening {
+    std::uint32_t a, b; // 연결된 방 인덱스
+    double flow;        // 교환 풍량 (m³/min)
+};
+
+static_assert(sizeof(FloorplanRoom) == 24, "FloorplanRoom is a file record");
+static_assert(sizeof(FloorplanOpening) == 16, "FloorplanOpening is a file record");
+
+// 다중 구역 건물 시나리오의 바이너리 파일 (리틀 엔디언) (SFML 비의존 코어)
+// [헤더 24바이트: 식별자 "IAPSFLR\0", 버전 u32, 구획 수 u32, 파일 크기 u64]
+// [구획 표: 구획마다 {종류 u32, 레코드 크기 u32, 시작 위치 u64, 레코드 수 u64}]
+// [구획 데이터: 방 배열, 개구부 배열 (시작 위치는 8바이트 정렬)]
+// 파일 전체를 메모리에 매핑하고 헤더와 구획 표만 검사하므로 방/개구부 배열은 복사 없이 바로 읽음 (방 수와 무관한 시간에 열림)
+// 모르는 종류의 구획은 건너뛰고, 지원하는 버전보다 새 파일이나 크기가 맞지 않는 파일은 거부
+class FloorplanFile {
+public:
+    FloorplanFile();
+    ~FloorplanFile();
+    FloorplanFile(const FloorplanFile&) = delete;
+    FloorplanFile& operator=(const FloorplanFile&) = delete;
+
+    // 파일을 매핑하고 검사 (실패하면 false, 오류 출력)
+    bool open(const std::string& filename);
+    void close();
+
+    // 매핑된 방/개구부 배열 (open() 성공 후 close() 전까지 유효)
+    const FloorplanRoom* rooms() const;
+    std::size_t roomCount() const;
+    const FloorplanOpening* openings() const;
+    std::size_t openingCount() const;
+
+    // 방/개구부 배열을 바이너리 파일로 저장 (실패하면 false)
+    static bool write(const std::string& filename, const std::vector<FloorplanRoom>& rooms, const std::vector<FloorplanOpening>& openings);
+    // 파일이 식별자로 시작하는지 (텍스트 형식과 구분)
+    static bool isFloorplanFile(const std::string& filename);
+
+    static const std::uint32_t FORMAT_VERSION; // 저장하는 형식 버전 (이보다 새 버전 파일은 거부)
+
+private:
+    const unsigned char* m_data; // 파일 전체 (매핑 또는 m_buffer)
+    std::size_t m_size;
+    bool m_mapped;               // mmap으로 매핑했는지 (아니면 m_buffer에 읽음)
+    std::vector<unsigned char> m_buffer;
+    const FloorplanRoom* m_rooms;
+    std::size_t m_roomCount;
+    const FloorplanOpening* m_openings;
+    std::size_t m_openingCount;
+
+    bool validate(const std::string& filename); // 헤더와 구획 표 검사 후 배열 위치 설정
+};
+
+#endif
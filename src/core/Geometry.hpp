@@ -0,0 +1,16 @@
+#ifndef GEOMETRY_HPP
+#define GEOMETRY_HPP
+
+// SFML에 의존하지 않는 기본 기하 구조체 (GUI와 헤드리스 코어가 공유)
+
+// 3D 좌표를 나타내는 간단한 구조체
+struct Vec3D {
+    float x, y, z; // x, y, z 좌표
+};
+
+// 3D 모델의 모서리를 나타내는 구조체 (두 정점 인덱스 저장)
+struct Edge {
+    int start, end; // 모서리를 구성하는 시작 정점과 끝 정점의 인덱스
+};
+
+#endif
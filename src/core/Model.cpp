@@ -0,0 +1,81 @@
+#include "Model.hpp"
+#include <cmath>
+
+// --- ConcentrationModel 클래스의 static const 멤버 변수 정의 ---
+// 오염물질별 기본 유입 속도(S) 및 제거 속도 상수(K) (밀폐 상태 기준)
+const float ConcentrationModel::BASE_S_PM10 = 30.0f;  // PM10 기본 유입 속도
+const float ConcentrationModel::BASE_K_PM10 = 0.005f; // PM10 기본 제거 상수
+const float ConcentrationModel::BASE_S_CO = 25.0f;    // CO 기본 유입 속도
+const float ConcentrationModel::BASE_K_CO = 0.002f;   // CO 기본 제거 상수
+const float ConcentrationModel::BASE_S_CL2 = 0.0f;    // CL2 기본 유입 속도
+const float ConcentrationModel::BASE_K_CL2 = 0.05f;   // CL2 기본 제거 상수
+
+// 통로 및 창문 개수에 따른 S, K 값 조정량
+const float ConcentrationModel::S_ADJUST_PASSAGE = 5.0f;  // 통로 1개당 S 증가량
+const float ConcentrationModel::K_ADJUST_PASSAGE = 0.02f; // 통로 1개당 K 증가량
+const float ConcentrationModel::S_ADJUST_WINDOW = 3.0f;   // 창문 1개당 S 증가량
+const float ConcentrationModel::K_ADJUST_WINDOW = 0.05f;  // 창문 1개당 K 증가량
+
+const float ConcentrationModel::MIN_K = 0.0001f;     // K 최소값
+const float ConcentrationModel::MIN_VOLUME = 0.001f; // 부피 최소값
+
+// 방 부피 계산
+float ConcentrationModel::roomVolume(const RoomConfig& room) {
+    float volume = room.width * room.depth * room.height;
+    if (volume < MIN_VOLUME) volume = MIN_VOLUME; // 부피가 0 또는 음수 되는 것 방지
+    return volume;
+}
+
+// 오염물질 및 통로/창문 개수에 따른 S, K 기본값 계산
+bool ConcentrationModel::defaultSK(int pollutantIndex, int numPassages, int numWindows, float& S, float& K) {
+    float base_S_val = 0.f, base_K_val = 0.f; // 선택된 오염물질의 기본 S, K 값
+    bool known = true; // 알려진 오염물질 인덱스인지 여부
+
+    switch (pollutantIndex) {
+        case 0: // 미세먼지 (PM10)
+            base_S_val = BASE_S_PM10;
+            base_K_val = BASE_K_PM10;
+            break;
+        case 1: // 일산화탄소 (CO)
+            base_S_val = BASE_S_CO;
+            base_K_val = BASE_K_CO;
+            break;
+        case 2: // 염소가스 (Cl2)
+            base_S_val = BASE_S_CL2;
+            base_K_val = BASE_K_CL2;
+            break;
+        default: // 알 수 없는 인덱스: PM10 기본값 사용 (경고 출력은 호출 측 책임)
+            base_S_val = BASE_S_PM10;
+            base_K_val = BASE_K_PM10;
+            known = false;
+    }
+    // 통로 및 창문 개수에 따른 조정량 반영
+    S = base_S_val + (numPassages * S_ADJUST_PASSAGE) + (numWindows * S_ADJUST_WINDOW);
+    K = base_K_val + (numPassages * K_ADJUST_PASSAGE) + (numWindows * K_ADJUST_WINDOW);
+    if (K < MIN_K) K = MIN_K; // K값이 0 또는 음수가 되지 않도록 최소값 보장
+    return known;
+}
+
+// 방 설정과 초기 농도로부터 기본 모델 파라미터 생성
+ModelParams ConcentrationModel::defaultParams(const RoomConfig& room, float C0) {
+    ModelParams p;
+    p.C0 = C0;
+    p.V = roomVolume(room);
+    defaultSK(room.pollutantIndex, room.numPassages, room.numWindows, p.S, p.K);
+    return p;
+}
+
+// 정상 상태 농도 S/(kV)
+float ConcentrationModel::steadyState(const ModelParams& p) {
+    if (p.K * p.V > 1e-9) { // 분모가 0에 매우 가깝지 않은 경우에만 계산
+        return p.S / (p.K * p.V);
+    }
+    return 0.0f;
+}
+
+// 시간 t에서의 농도 C(t)
+float ConcentrationModel::concentrationAt(const ModelParams& p, float t) {
+    float term_S_kV = steadyState(p);
+    float c = (p.C0 - term_S_kV) * std::exp(-p.K * t) + term_S_kV;
+    return (c < 0.f) ? 0.f : c; // 농도는 음수가 될 수 없음
+}
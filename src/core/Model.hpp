@@ -0,0 +1,49 @@
+#ifndef MODEL_HPP
+#define MODEL_HPP
+
+// 실내 공기 오염 농도 모델 (SFML 비의존 코어)
+// C(t) = (C0 - S/(kV)) * exp(-kt) + S/(kV)
+
+// 방 크기, 오염물질, 개구부 개수로 이루어진 방 설정 구조체
+struct RoomConfig {
+    float width, depth, height; // 방의 실제 크기 (m)
+    int pollutantIndex;         // 오염물질 인덱스 (0: PM10, 1: CO, 2: Cl2)
+    int numPassages, numWindows; // 통로 및 창문 개수
+};
+
+// 농도 공식의 파라미터 묶음
+struct ModelParams {
+    float C0; // 초기 농도
+    float S;  // 유입 속도
+    float K;  // 제거 속도 상수
+    float V;  // 방의 부피 (m³)
+};
+
+// 농도 모델 계산을 담당하는 클래스 (상태 없음, static 함수만 제공)
+class ConcentrationModel {
+public:
+    // 방 부피 계산 (최소값 MIN_VOLUME 보장)
+    static float roomVolume(const RoomConfig& room);
+    // 오염물질 및 개구부 개수에 따른 S, K 기본값 계산 (알 수 없는 인덱스면 PM10 기본값 사용, 반환값 false)
+    static bool defaultSK(int pollutantIndex, int numPassages, int numWindows, float& S, float& K);
+    // 방 설정과 초기 농도로부터 기본 모델 파라미터 생성
+    static ModelParams defaultParams(const RoomConfig& room, float C0);
+    // 정상 상태 농도 S/(kV) (K*V가 0에 가까우면 0 반환)
+    static float steadyState(const ModelParams& p);
+    // 시간 t(분)에서의 농도 C(t) (음수는 0으로 보정)
+    static float concentrationAt(const ModelParams& p, float t);
+
+    // 오염물질별 기본 S, K 값 (밀폐 상태 기준)
+    static const float BASE_S_PM10; static const float BASE_K_PM10;
+    static const float BASE_S_CO;   static const float BASE_K_CO;
+    static const float BASE_S_CL2;  static const float BASE_K_CL2;
+
+    // 통로 및 창문 1개당 S, K 조정량
+    static const float S_ADJUST_PASSAGE; static const float K_ADJUST_PASSAGE;
+    static const float S_ADJUST_WINDOW;  static const float K_ADJUST_WINDOW;
+
+    static const float MIN_K;      // K 최소값 (0으로 나누기 방지)
+    static const float MIN_VOLUME; // 부피 최소값
+};
+
+#endif
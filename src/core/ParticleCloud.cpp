@@ -0,0 +1,127 @@
+#include "ParticleCloud.hpp"
+#include "Philox.hpp"
+#include <algorithm>
+#include <cmath>
+
+const std::uint32_t ParticleCloud::DEFAULT_SEED = 0x1A2B3C4Du;
+const float ParticleCloud::ROOM_HALF = 0.5f;
+const float ParticleCloud::SPAWN_HALF = 0.49f;
+const float ParticleCloud::MAX_SPEED = 0.02f;
+const float ParticleCloud::MAX_LIFETIME = 5.0f;
+const float ParticleCloud::FADE_RATE = 255.0f / ParticleCloud::MAX_LIFETIME; // 최대 수명 동안 완전히 사라짐
+const float ParticleCloud::PERIOD = ParticleCloud::MAX_LIFETIME + 255.0f / ParticleCloud::FADE_RATE;
+// 작업 하나가 수 μs 이상 걸리도록 해 작업 제출 비용을 가림
+const std::size_t ParticleCloud::PARALLEL_GRAIN = 1 << 14;
+const std::size_t ParticleCloud::CHUNK = 256; // 작업 배열 10개 × 1 KB (L1 캐시에 머무름)
+const std::size_t ParticleCloud::BATCH_REDRAW = 32; // 개별 생성(카운터 2개 스칼라)이 일괄 생성보다 느려지는 대략의 개수
+
+// Philox 키 상위 워드 (다른 용도의 난수와 겹치지 않도록 파티클 전용 값 사용)
+static const std::uint32_t PARTICLE_KEY = 0x50415254u; // "PART"
+// 세대 시작 위상: i × (황금비 - 1)의 소수 부분은 [0, 1)에 고르게 퍼짐
+static const double PHASE_STEP = 0.6180339887498949;
+// 정수 변환으로 구한 floor (std::floor와 같은 값, SSE4.1 없는 기본 x86-64 빌드에서도 라이브러리 호출 없이 벡터화됨)
+// 범위: |v| < 2^31 (위치, 위상) / 2^63 (세대)
+static inline float floorInt(float v) {
+    float truncated = static_cast<float>(static_cast<std::int32_t>(v));
+    return truncated - (truncated > v ? 1.f : 0.f);
+}
+static inline double floorInt(double v) {
+    double truncated = static_cast<double>(static_cast<std::int64_t>(v));
+    return truncated - (truncated > v ? 1.0 : 0.0);
+}
+
+// 아직 채우지 않은 캐시 항목 (실제 세대는 PERIOD × 2^32초 뒤에나 이 값이 됨)
+static const std::uint32_t INVALID_GENERATION = 0xFFFFFFFFu;
+
+ParticleCloud::ParticleCloud(std::uint32_t seed) : m_seed(seed), m_pool(nullptr) {}
+
+void ParticleCloud::setSeed(std::uint32_t seed) {
+    m_seed = seed;
+    std::fill(m_generation.begin(), m_generation.end(), INVALID_GENERATION); // 다른 시드의 값은 다시 뽑음
+}
+std::uint32_t ParticleCloud::seed() const { return m_seed; }
+void ParticleCloud::setThreadPool(ThreadPool* pool) { m_pool = pool; }
+
+void ParticleCloud::reserveCache(std::size_t count) const {
+    if (m_generation.size() >= count) return;
+    m_generation.resize(count, INVALID_GENERATION);
+    for (std::vector<float>* column : {&m_originX, &m_originY, &m_originZ, &m_velocityX, &m_velocityY, &m_velocityZ, &m_lifetime}) {
+        column->resize(count);
+    }
+}
+
+// 균등 난수 [0, 1)를 시작 위치(±SPAWN_HALF), 속도(±MAX_SPEED), 수명(MAX_LIFETIME의 50% ~ 100%)으로 바꿔 저장
+void ParticleCloud::storeDraws(std::size_t i, std::uint32_t generation, float sx, float sy, float sz, float vx, float vy, float vz, float life) const {
+    m_generation[i] = generation;
+    m_originX[i] = (2.f * sx - 1.f) * SPAWN_HALF; m_velocityX[i] = (2.f * vx - 1.f) * MAX_SPEED;
+    m_originY[i] = (2.f * sy - 1.f) * SPAWN_HALF; m_velocityY[i] = (2.f * vy - 1.f) * MAX_SPEED;
+    m_originZ[i] = (2.f * sz - 1.f) * SPAWN_HALF; m_velocityZ[i] = (2.f * vz - 1.f) * MAX_SPEED;
+    m_lifetime[i] = MAX_LIFETIME * (0.5f + 0.5f * life);
+}
+
+void ParticleCloud::evaluate(double t, std::size_t count, float* x, float* y, float* z, float* alpha) const {
+    if (count == 0) return;
+    reserveCache(count); // 병렬 구간 밖에서 한 번만 크기 변경
+    if (m_pool && m_pool->size() > 1 && count > PARALLEL_GRAIN) {
+        std::size_t grain = std::max(PARALLEL_GRAIN, (count + m_pool->size() - 1) / m_pool->size());
+        m_pool->parallelFor(0, count, grain, [this, t, x, y, z, alpha](std::size_t begin, std::size_t end) {
+            evaluateRange(t, begin, end, x, y, z, alpha);
+        });
+    } else {
+        evaluateRange(t, 0, count, x, y, z, alpha);
+    }
+}
+
+// CHUNK개씩: 세대/나이 계산 → 캐시와 세대가 다른 파티클만 다시 뽑음 (많으면 Philox 블록 2개(시작 위치 x/y/z + 속도 x,
+// 속도 y/z + 수명)를 CHUNK 전체에 일괄 생성, 적으면 그 파티클만 스칼라 생성, 두 경로의 난수는 비트 단위로 같음) →
+// 캐시 값으로 분기 없는 루프에서 위치(경계 순환은 floor)와 투명도(페이드는 max/min) 계산
+void ParticleCloud::evaluateRange(double t, std::size_t begin, std::size_t end, float* x, float* y, float* z, float* alpha) const {
+    const float span = 2.f * ROOM_HALF;
+    const Philox::Key key = {m_seed, PARTICLE_KEY};
+    std::uint32_t generation[CHUNK];
+    float age[CHUNK];
+    float startX[CHUNK], startY[CHUNK], startZ[CHUNK], velX[CHUNK], velY[CHUNK], velZ[CHUNK], life[CHUNK], unused[CHUNK];
+    for (std::size_t first = begin; first < end; first += CHUNK) {
+        const std::size_t n = std::min(CHUNK, end - first);
+        std::size_t stale = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+            double phase = static_cast<double>(first + k) * PHASE_STEP;
+            double local = t + (phase - floorInt(phase)) * PERIOD;
+            double g = floorInt(local / PERIOD);
+            generation[k] = static_cast<std::uint32_t>(g);
+            age[k] = static_cast<float>(local - g * PERIOD); // 현재 세대에서 지난 시간 (0 ~ PERIOD)
+            stale += m_generation[first + k] != generation[k];
+        }
+        const std::uint32_t firstId = static_cast<std::uint32_t>(first);
+        if (stale > BATCH_REDRAW) {
+            Philox::uniformBatch(key, firstId, generation, 0u, 0u, startX, startY, startZ, velX, n);
+            Philox::uniformBatch(key, firstId, generation, 1u, 0u, velY, velZ, life, unused, n);
+            for (std::size_t k = 0; k < n; ++k) {
+                storeDraws(first + k, generation[k], startX[k], startY[k], startZ[k], velX[k], velY[k], velZ[k], life[k]);
+            }
+        } else if (stale > 0) {
+            for (std::size_t k = 0; k < n; ++k) {
+                if (m_generation[first + k] == generation[k]) continue;
+                std::uint32_t id = firstId + static_cast<std::uint32_t>(k);
+                Philox::Counter a = Philox::generate({id, generation[k], 0u, 0u}, key);
+                Philox::Counter b = Philox::generate({id, generation[k], 1u, 0u}, key);
+                storeDraws(first + k, generation[k], Philox::toUniform(a[0]), Philox::toUniform(a[1]), Philox::toUniform(a[2]),
+                           Philox::toUniform(a[3]), Philox::toUniform(b[0]), Philox::toUniform(b[1]), Philox::toUniform(b[2]));
+            }
+        }
+
+        const float* origins[3] = {m_originX.data() + first, m_originY.data() + first, m_originZ.data() + first};
+        const float* velocities[3] = {m_velocityX.data() + first, m_velocityY.data() + first, m_velocityZ.data() + first};
+        float* positions[3] = {x + first, y + first, z + first};
+        for (int axis = 0; axis < 3; ++axis) {
+            for (std::size_t k = 0; k < n; ++k) {
+                float p = origins[axis][k] + velocities[axis][k] * age[k];
+                positions[axis][k] = p - span * floorInt((p + ROOM_HALF) / span); // 한쪽 벽을 넘으면 반대쪽 벽에서 나타남
+            }
+        }
+        const float* lifetime = m_lifetime.data() + first;
+        for (std::size_t k = 0; k < n; ++k) {
+            alpha[first + k] = std::clamp(255.f - FADE_RATE * std::max(age[k] - lifetime[k], 0.f), 0.f, 255.f);
+        }
+    }
+}
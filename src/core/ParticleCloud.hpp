@@ -0,0 +1,57 @@
+#ifndef PARTICLE_CLOUD_HPP
+#define PARTICLE_CLOUD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ThreadPool.hpp"
+
+// 시각화용 먼지 파티클 구름 (상태 없음)
+// 파티클 i의 위치와 투명도는 (시드, i, 애니메이션 시간 t)만의 순수 함수라 이전 프레임이나 이동 이력이 필요 없음
+// 각 파티클은 PERIOD초 주기로 다시 태어나며(세대), 세대마다 시작 위치/속도/수명을 Philox 카운터 {i, 세대, 블록}으로 정함
+// (세대 시작 시각은 황금비 수열로 파티클마다 고르게 엇갈려 있어 한꺼번에 다시 태어나지 않음)
+// 난수는 CHUNK개씩 Philox 일괄 생성(SIMD)으로 채운 뒤 위치/투명도를 분기 없는 루프로 계산
+// 한 세대 안에서는 등속 이동 후 방 경계에서 반대쪽으로 순환하고, 수명이 다하면 FADE_RATE로 페이드 아웃
+// 따라서 임의 시간으로 이동(타임라인 탐색, 되감기)해도 evaluate() 한 번으로 구름 전체가 다시 만들어짐
+// 세대마다 뽑은 값(시작 위치, 속도, 수명)은 파티클별로 캐시해 두고 세대가 바뀐 파티클만 다시 뽑으므로
+// 연속 프레임에서는 프레임당 대부분 파티클이 난수 생성 없이 등속 이동 식 한 번으로 끝남
+// (60 FPS에서 한 프레임에 세대가 바뀌는 파티클은 약 1/600, 캐시는 결과를 바꾸지 않으며 탐색 직후 한 프레임만 전체 생성)
+// 위치는 방 크기로 정규화된 로컬 좌표 (-0.5 ~ 0.5)
+class ParticleCloud {
+public:
+    explicit ParticleCloud(std::uint32_t seed = DEFAULT_SEED);
+
+    void setSeed(std::uint32_t seed);
+    std::uint32_t seed() const;
+    // 계산을 나누어 실행할 스레드 풀 (nullptr이면 단일 스레드)
+    void setThreadPool(ThreadPool* pool);
+
+    // 애니메이션 시간 t(초)에서 파티클 [0, count)의 위치와 투명도(0 ~ 255)를 계산
+    // (세대 캐시를 갱신하므로 같은 객체에서 동시에 호출하지 않음)
+    void evaluate(double t, std::size_t count, float* x, float* y, float* z, float* alpha) const;
+
+    static const std::uint32_t DEFAULT_SEED;
+    static const float ROOM_HALF;            // 정규화 방 경계 (±0.5)
+    static const float SPAWN_HALF;           // 시작 위치 범위 (±, 벽 약간 안쪽)
+    static const float MAX_SPEED;            // 축별 최대 속도 (초당 정규화 좌표)
+    static const float MAX_LIFETIME;         // 최대 수명 (초, 세대마다 50% ~ 100%)
+    static const float FADE_RATE;            // 수명이 다한 뒤 초당 알파 감소량
+    static const float PERIOD;               // 세대 주기 (초, 최대 수명 + 완전히 사라지는 시간)
+    static const std::size_t PARALLEL_GRAIN; // 병렬 실행 시 작업 하나가 맡는 최소 파티클 수
+    static const std::size_t CHUNK;          // 난수 일괄 생성 단위 (스택 작업 배열 크기)
+    static const std::size_t BATCH_REDRAW;   // CHUNK 안에서 세대가 바뀐 파티클이 이보다 많으면 개별 대신 일괄 생성
+
+private:
+    std::uint32_t m_seed;
+    ThreadPool* m_pool;
+    // 파티클별 세대 캐시 (SoA, 구간마다 다른 작업자가 채움): 캐시한 세대 번호와 그 세대의 시작 위치, 속도, 수명
+    mutable std::vector<std::uint32_t> m_generation;
+    mutable std::vector<float> m_originX, m_originY, m_originZ, m_velocityX, m_velocityY, m_velocityZ, m_lifetime;
+
+    void reserveCache(std::size_t count) const; // 캐시를 count개 이상으로 (새 항목은 무효)
+    void storeDraws(std::size_t i, std::uint32_t generation, float sx, float sy, float sz, float vx, float vy, float vz, float life) const;
+
+    void evaluateRange(double t, std::size_t begin, std::size_t end, float* x, float* y, float* z, float* alpha) const;
+};
+
+#endif
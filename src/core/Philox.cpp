@@ -0,0 +1,195 @@
+#include "Philox.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IAPS_PHILOX_X86 1 // GCC/Clang x86: target 속성으로 ISA별 함수를 한 파일에 컴파일
+#include <immintrin.h>
+#endif
+
+const int Philox::ROUNDS = 10;
+
+// 라운드 곱셈 상수와 키 증가량 (Random123 기준값)
+static const std::uint32_t PHILOX_M0 = 0xD2511F53u;
+static const std::uint32_t PHILOX_M1 = 0xCD9E8D57u;
+static const std::uint32_t PHILOX_W0 = 0x9E3779B9u; // 황금비
+static const std::uint32_t PHILOX_W1 = 0xBB67AE85u; // sqrt(3) - 1
+static const float UNIFORM_SCALE = 1.0f / 16777216.0f; // 2^-24
+
+// --- 스칼라 구현 ---
+static inline void mulhilo(std::uint32_t a, std::uint32_t b, std::uint32_t& hi, std::uint32_t& lo) {
+    std::uint64_t product = static_cast<std::uint64_t>(a) * b;
+    hi = static_cast<std::uint32_t>(product >> 32);
+    lo = static_cast<std::uint32_t>(product);
+}
+
+Philox::Counter Philox::generate(const Counter& counter, const Key& key) {
+    Counter c = counter;
+    std::uint32_t k0 = key[0], k1 = key[1];
+    for (int round = 0; round < ROUNDS; ++round) {
+        std::uint32_t hi0, lo0, hi1, lo1;
+        mulhilo(PHILOX_M0, c[0], hi0, lo0);
+        mulhilo(PHILOX_M1, c[2], hi1, lo1);
+        c = {hi1 ^ c[1] ^ k0, lo1, hi0 ^ c[3] ^ k1, lo0};
+        k0 += PHILOX_W0; k1 += PHILOX_W1;
+    }
+    return c;
+}
+
+float Philox::toUniform(std::uint32_t bits) { return static_cast<float>(bits >> 8) * UNIFORM_SCALE; }
+
+static void uniformBatchScalar(const Philox::Key& key, std::uint32_t firstId, const std::uint32_t* word1, std::uint32_t word2, std::uint32_t word3,
+                               float* out0, float* out1, float* out2, float* out3, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        Philox::Counter r = Philox::generate({firstId + static_cast<std::uint32_t>(i), word1[i], word2, word3}, key);
+        out0[i] = Philox::toUniform(r[0]); out1[i] = Philox::toUniform(r[1]);
+        out2[i] = Philox::toUniform(r[2]); out3[i] = Philox::toUniform(r[3]);
+    }
+}
+
+#ifdef IAPS_PHILOX_X86
+// --- SSE2 구현 (카운터 4개씩) ---
+// _mm_mul_epu32는 짝수 원소의 32x32→64 곱만 계산하므로 홀수 원소는 64비트 시프트 후 한 번 더 곱하고,
+// 두 결과의 하위/상위 32비트를 원래 원소 순서로 다시 섞음
+__attribute__((target("sse2")))
+static inline void mulhiloSse2(__m128i a, __m128i b, __m128i& hi, __m128i& lo) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    lo = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(2, 0, 2, 0)));
+    hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+__attribute__((target("sse2")))
+static inline __m128 toUniformSse2(__m128i bits) {
+    return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 8)), _mm_set1_ps(UNIFORM_SCALE));
+}
+
+__attribute__((target("sse2")))
+static void uniformBatchSse2(const Philox::Key& key, std::uint32_t firstId, const std::uint32_t* word1, std::uint32_t word2, std::uint32_t word3,
+                             float* out0, float* out1, float* out2, float* out3, std::size_t n) {
+    const __m128i m0 = _mm_set1_epi32(static_cast<int>(PHILOX_M0)), m1 = _mm_set1_epi32(static_cast<int>(PHILOX_M1));
+    const __m128i w0 = _mm_set1_epi32(static_cast<int>(PHILOX_W0)), w1 = _mm_set1_epi32(static_cast<int>(PHILOX_W1));
+    const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i c0 = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(firstId + static_cast<std::uint32_t>(i))), lane);
+        __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(word1 + i));
+        __m128i c2 = _mm_set1_epi32(static_cast<int>(word2)), c3 = _mm_set1_epi32(static_cast<int>(word3));
+        __m128i k0 = _mm_set1_epi32(static_cast<int>(key[0])), k1 = _mm_set1_epi32(static_cast<int>(key[1]));
+        for (int round = 0; round < Philox::ROUNDS; ++round) {
+            __m128i hi0, lo0, hi1, lo1;
+            mulhiloSse2(m0, c0, hi0, lo0);
+            mulhiloSse2(m1, c2, hi1, lo1);
+            c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), k0);
+            c1 = lo1;
+            c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), k1);
+            c3 = lo0;
+            k0 = _mm_add_epi32(k0, w0); k1 = _mm_add_epi32(k1, w1);
+        }
+        _mm_storeu_ps(out0 + i, toUniformSse2(c0)); _mm_storeu_ps(out1 + i, toUniformSse2(c1));
+        _mm_storeu_ps(out2 + i, toUniformSse2(c2)); _mm_storeu_ps(out3 + i, toUniformSse2(c3));
+    }
+    uniformBatchScalar(key, firstId + static_cast<std::uint32_t>(i), word1 + i, word2, word3, out0 + i, out1 + i, out2 + i, out3 + i, n - i);
+}
+
+// --- AVX2 구현 (카운터 8개씩, 128비트 절반마다 SSE2와 같은 섞기) ---
+__attribute__((target("avx2")))
+static inline void mulhiloAvx2(__m256i a, __m256i b, __m256i& hi, __m256i& lo) {
+    __m256i even = _mm256_mul_epu32(a, b);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    lo = _mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, _MM_SHUFFLE(2, 0, 2, 0)), _mm256_shuffle_epi32(odd, _MM_SHUFFLE(2, 0, 2, 0)));
+    hi = _mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, _MM_SHUFFLE(3, 1, 3, 1)), _mm256_shuffle_epi32(odd, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256 toUniformAvx2(__m256i bits) {
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 8)), _mm256_set1_ps(UNIFORM_SCALE));
+}
+
+__attribute__((target("avx2")))
+static void uniformBatchAvx2(const Philox::Key& key, std::uint32_t firstId, const std::uint32_t* word1, std::uint32_t word2, std::uint32_t word3,
+                             float* out0, float* out1, float* out2, float* out3, std::size_t n) {
+    const __m256i m0 = _mm256_set1_epi32(static_cast<int>(PHILOX_M0)), m1 = _mm256_set1_epi32(static_cast<int>(PHILOX_M1));
+    const __m256i w0 = _mm256_set1_epi32(static_cast<int>(PHILOX_W0)), w1 = _mm256_set1_epi32(static_cast<int>(PHILOX_W1));
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i c0 = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(firstId + static_cast<std::uint32_t>(i))), lane);
+        __m256i c1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(word1 + i));
+        __m256i c2 = _mm256_set1_epi32(static_cast<int>(word2)), c3 = _mm256_set1_epi32(static_cast<int>(word3));
+        __m256i k0 = _mm256_set1_epi32(static_cast<int>(key[0])), k1 = _mm256_set1_epi32(static_cast<int>(key[1]));
+        for (int round = 0; round < Philox::ROUNDS; ++round) {
+            __m256i hi0, lo0, hi1, lo1;
+            mulhiloAvx2(m0, c0, hi0, lo0);
+            mulhiloAvx2(m1, c2, hi1, lo1);
+            c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), k0);
+            c1 = lo1;
+            c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), k1);
+            c3 = lo0;
+            k0 = _mm256_add_epi32(k0, w0); k1 = _mm256_add_epi32(k1, w1);
+        }
+        _mm256_storeu_ps(out0 + i, toUniformAvx2(c0)); _mm256_storeu_ps(out1 + i, toUniformAvx2(c1));
+        _mm256_storeu_ps(out2 + i, toUniformAvx2(c2)); _mm256_storeu_ps(out3 + i, toUniformAvx2(c3));
+    }
+    uniformBatchSse2(key, firstId + static_cast<std::uint32_t>(i), word1 + i, word2, word3, out0 + i, out1 + i, out2 + i, out3 + i, n - i);
+}
+#endif
+
+// 일괄 생성 구현 종류 (최초 호출 시 한 번만 판정)
+enum class PhiloxIsa { Scalar, SSE2, AVX2 };
+
+static PhiloxIsa selectIsa() {
+#ifdef IAPS_PHILOX_X86
+    if (__builtin_cpu_supports("avx2")) return PhiloxIsa::AVX2;
+    if (__builtin_cpu_supports("sse2")) return PhiloxIsa::SSE2;
+#endif
+    return PhiloxIsa::Scalar;
+}
+
+static PhiloxIsa activeIsa() {
+    static const PhiloxIsa selected = selectIsa();
+    return selected;
+}
+
+const char* Philox::activeIsaName() {
+    switch (activeIsa()) {
+        case PhiloxIsa::AVX2: return "avx2";
+        case PhiloxIsa::SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+void Philox::uniformBatch(const Key& key, std::uint32_t firstId, const std::uint32_t* word1, std::uint32_t word2, std::uint32_t word3,
+                          float* out0, float* out1, float* out2, float* out3, std::size_t n) {
+#ifdef IAPS_PHILOX_X86
+    PhiloxIsa isa = activeIsa();
+    if (isa == PhiloxIsa::AVX2) { uniformBatchAvx2(key, firstId, word1, word2, word3, out0, out1, out2, out3, n); return; }
+    if (isa == PhiloxIsa::SSE2) { uniformBatchSse2(key, firstId, word1, word2, word3, out0, out1, out2, out3, n); return; }
+#endif
+    uniformBatchScalar(key, firstId, word1, word2, word3, out0, out1, out2, out3, n);
+}
+
+// Random123 philox4x32_10 알려진 답 벡터 3개 + 일괄 생성(벡터 경로와 나머지 원소)과 스칼라 비교
+bool Philox::selfTest() {
+    struct KnownAnswer { Counter counter; Key key; Counter expected; };
+    const KnownAnswer answers[] = {
+        {{0u, 0u, 0u, 0u}, {0u, 0u}, {0x6627E8D5u, 0xE169C58Du, 0xBC57AC4Cu, 0x9B00DBD8u}},
+        {{0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu}, {0xFFFFFFFFu, 0xFFFFFFFFu}, {0x408F276Du, 0x41C83B0Eu, 0xA20BC7C6u, 0x6D5451FDu}},
+        {{0x243F6A88u, 0x85A308D3u, 0x13198A2Eu, 0x03707344u}, {0xA4093822u, 0x299F31D0u}, {0xD16CFE09u, 0x94FDCCEBu, 0x5001E420u, 0x24126EA1u}},
+    };
+    for (const KnownAnswer& answer : answers) {
+        if (generate(answer.counter, answer.key) != answer.expected) return false;
+    }
+
+    const std::size_t N = 37; // 8의 배수가 아니어서 나머지 원소 경로도 확인
+    const Key key = {0x12345678u, 0x9ABCDEF0u};
+    std::uint32_t word1[N];
+    float out[4][N];
+    for (std::size_t i = 0; i < N; ++i) word1[i] = static_cast<std::uint32_t>(i * 2654435761u);
+    uniformBatch(key, 1000u, word1, 7u, 11u, out[0], out[1], out[2], out[3], N);
+    for (std::size_t i = 0; i < N; ++i) {
+        Counter r = generate({1000u + static_cast<std::uint32_t>(i), word1[i], 7u, 11u}, key);
+        for (int lane = 0; lane < 4; ++lane) {
+            if (out[lane][i] != toUniform(r[lane])) return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,35 @@
+#ifndef PHILOX_HPP
+#define PHILOX_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Philox4x32-10 카운터 기반 난수 생성기 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11)
+// 128비트 카운터와 64비트 키를 10라운드 곱셈-xor로 섞어 32비트 난수 4개를 만듦
+// 내부 상태가 없어 같은 (카운터, 키)는 항상 같은 값을 내고, 서로 다른 카운터는 독립적으로 계산되므로
+// 여러 스레드가 잠금 없이 나누어 생성하거나 임의 위치의 값을 바로 계산할 수 있음
+// 일괄 생성은 x86에서 실행 시점에 AVX2(8개) / SSE2(4개) 경로를 선택하고, 모든 경로의 결과는 스칼라와 비트 단위로 같음
+class Philox {
+public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    // 카운터 하나에 대한 32비트 난수 4개
+    static Counter generate(const Counter& counter, const Key& key);
+    // 32비트 난수 → [0, 1) 균등 분포 float (상위 24비트 사용)
+    static float toUniform(std::uint32_t bits);
+
+    // 원소 i마다 카운터 {firstId + i, word1[i], word2, word3}의 난수 4개를 [0, 1) float로 out0..out3[i]에 기록
+    static void uniformBatch(const Key& key, std::uint32_t firstId, const std::uint32_t* word1, std::uint32_t word2, std::uint32_t word3,
+                             float* out0, float* out1, float* out2, float* out3, std::size_t n);
+
+    // 일괄 생성에 사용되는 구현 이름 ("avx2", "sse2", "scalar")
+    static const char* activeIsaName();
+    // 공개된 알려진 답(known-answer) 벡터와 일괄 생성/스칼라 일치 여부 확인 (검증용)
+    static bool selfTest();
+
+    static const int ROUNDS; // 라운드 수 (10)
+};
+
+#endif
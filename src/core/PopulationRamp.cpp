@@ -0,0 +1,46 @@
+#include "PopulationRamp.hpp"
+#include <algorithm>
+#include <cmath>
+
+const double PopulationRamp::DEFAULT_DURATION = 1.0;
+
+PopulationRamp::PopulationRamp() : m_curve(Curve::SmoothStep), m_duration(DEFAULT_DURATION), m_from(0), m_to(0), m_start(0.0) {}
+
+void PopulationRamp::setCurve(Curve curve, double duration) {
+    m_curve = curve;
+    m_duration = std::max(duration, 0.0);
+}
+
+PopulationRamp::Curve PopulationRamp::curve() const { return m_curve; }
+double PopulationRamp::duration() const { return m_duration; }
+
+void PopulationRamp::retarget(std::size_t target, double now) {
+    if (target == m_to) return;
+    m_from = value(now);
+    m_to = target;
+    m_start = now;
+}
+
+void PopulationRamp::snap(std::size_t target) {
+    m_from = m_to = target;
+    m_start = 0.0;
+}
+
+double PopulationRamp::progress(double now) const {
+    if (m_curve == Curve::Step || m_duration <= 0.0) return 1.0;
+    double x = std::clamp((now - m_start) / m_duration, 0.0, 1.0);
+    switch (m_curve) {
+        case Curve::SmoothStep: return x * x * (3.0 - 2.0 * x);
+        case Curve::EaseOut: { double r = 1.0 - x; return 1.0 - r * r * r; }
+        default: return x;
+    }
+}
+
+// 시작 개수와 목표 개수 사이를 진행률로 보간 (반올림, 진행률 1이면 정확히 목표)
+std::size_t PopulationRamp::value(double now) const {
+    double from = static_cast<double>(m_from), to = static_cast<double>(m_to);
+    return static_cast<std::size_t>(std::llround(from + (to - from) * progress(now)));
+}
+
+std::size_t PopulationRamp::target() const { return m_to; }
+bool PopulationRamp::active(double now) const { return value(now) != m_to; }
@@ -0,0 +1,46 @@
+#ifndef POPULATION_RAMP_HPP
+#define POPULATION_RAMP_HPP
+
+#include <cstddef>
+
+// 표시 파티클 수를 목표 개수로 부드럽게 옮기는 곡선 (SFML 비의존 코어)
+// 표시 개수는 (시작 개수, 목표 개수, 목표가 바뀐 뒤 지난 시간)만의 함수라 몇 개가 늘거나 줄든 계산 비용은 O(1)
+// (상태 없는 파티클 구름에서 생성/소멸은 개수만 바꾸면 되므로, 변화량이 10만 개여도 애니메이션 방식과 비용이 무관)
+class PopulationRamp {
+public:
+    // 곡선 종류 (진행률 0 → 1을 시작 개수 → 목표 개수에 대응)
+    enum class Curve {
+        Step,       // 바로 목표 개수
+        Linear,     // 일정한 속도
+        SmoothStep, // 천천히 시작해 천천히 도착 (3x² - 2x³)
+        EaseOut     // 빠르게 시작해 천천히 도착 (1 - (1 - x)³)
+    };
+
+    PopulationRamp();
+
+    // 곡선과 전체 변화 시간(초) 설정 (진행 중인 변화에는 다음 목표 변경부터 적용)
+    void setCurve(Curve curve, double duration);
+    Curve curve() const;
+    double duration() const;
+
+    // 목표 개수 변경: 시각 now(초)의 표시 개수에서 새 목표로 다시 출발
+    void retarget(std::size_t target, double now);
+    // 곡선 없이 바로 목표 개수로 (초기화, 시간 이동)
+    void snap(std::size_t target);
+
+    std::size_t value(double now) const; // 시각 now의 표시 개수
+    std::size_t target() const;          // 목표 개수
+    bool active(double now) const;       // 아직 목표에 도달하지 않았는지
+
+    static const double DEFAULT_DURATION; // 기본 변화 시간 (초)
+
+private:
+    Curve m_curve;
+    double m_duration;
+    std::size_t m_from, m_to; // 시작/목표 개수
+    double m_start;           // 목표가 바뀐 시각 (초)
+
+    double progress(double now) const; // 곡선을 적용한 진행률 (0 ~ 1)
+};
+
+#endif
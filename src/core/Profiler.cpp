@@ -0,0 +1,142 @@
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+const std::size_t Profiler::WINDOW = 240;              // 60 FPS에서 약 4초
+const std::size_t Profiler::MAX_TRACE_EVENTS = 1 << 20; // 이벤트당 약 32바이트, 프레임당 수십 개면 몇 분 분량
+const int Profiler::HISTOGRAM_BINS = 17;                // 1 μs ~ 65 ms (+ 그 이상)
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler() : m_enabled(false), m_capturing(false), m_epoch(Clock::now()) {}
+
+void Profiler::setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+// 스레드 번호: 처음 기록하는 순서대로 1, 2, ... (trace 뷰어의 tid)
+std::uint32_t Profiler::threadNumber() {
+    static std::atomic<std::uint32_t> nextThread{1};
+    thread_local std::uint32_t number = nextThread.fetch_add(1, std::memory_order_relaxed);
+    return number;
+}
+
+// 구간 찾기: 같은 내용의 리터럴이 번역 단위마다 주소가 다를 수 있으므로 주소가 다르면 내용 비교
+Profiler::Section& Profiler::section(const char* category, const char* name) {
+    for (auto& s : m_sections) {
+        if ((s.name == name || std::strcmp(s.name, name) == 0) &&
+            (s.category == category || std::strcmp(s.category, category) == 0)) return s;
+    }
+    m_sections.push_back({category, name, {}, 0, 0, 0.f});
+    m_sections.back().samples.reserve(WINDOW);
+    return m_sections.back();
+}
+
+void Profiler::record(const char* category, const char* name, Clock::time_point start, Clock::time_point end) {
+    float seconds = std::chrono::duration<float>(end - start).count();
+    std::uint32_t thread = threadNumber();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Section& s = section(category, name);
+    if (s.samples.size() < WINDOW) s.samples.push_back(seconds);
+    else s.samples[s.next] = seconds;
+    s.next = (s.next + 1) % WINDOW;
+    s.last = seconds;
+    ++s.count;
+    if (m_capturing.load(std::memory_order_relaxed) && m_events.size() < MAX_TRACE_EVENTS) {
+        double begin = std::chrono::duration<double, std::micro>(start - m_epoch).count();
+        double duration = std::chrono::duration<double, std::micro>(end - start).count();
+        m_events.push_back({category, name, begin, duration, thread});
+    }
+}
+
+// 백분위 값 (정렬된 표본에서 가장 가까운 순위)
+static double percentile(const std::vector<float>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    std::size_t rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+std::vector<ProfileSectionStats> Profiler::stats() const {
+    std::vector<ProfileSectionStats> result;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    result.reserve(m_sections.size());
+    std::vector<float> sorted;
+    for (const auto& s : m_sections) {
+        ProfileSectionStats stats;
+        stats.category = s.category;
+        stats.name = s.name;
+        stats.last = s.last;
+        stats.count = s.count;
+        stats.histogram.assign(HISTOGRAM_BINS, 0);
+        sorted = s.samples;
+        std::sort(sorted.begin(), sorted.end());
+        stats.p50 = percentile(sorted, 0.5);
+        stats.p99 = percentile(sorted, 0.99);
+        for (float seconds : sorted) {
+            float micros = std::max(seconds * 1e6f, 1.f);
+            int bin = std::min(static_cast<int>(std::log2(micros)), HISTOGRAM_BINS - 1);
+            ++stats.histogram[bin];
+        }
+        result.push_back(std::move(stats));
+    }
+    return result;
+}
+
+void Profiler::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sections.clear();
+    m_events.clear();
+}
+
+void Profiler::beginCapture() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events.clear();
+    m_capturing.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::endCapture() { m_capturing.store(false, std::memory_order_relaxed); }
+bool Profiler::capturing() const { return m_capturing.load(std::memory_order_relaxed); }
+
+std::size_t Profiler::capturedEvents() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_events.size();
+}
+
+// JSON 문자열 값 (구간 이름은 리터럴이지만 따옴표와 역슬래시, 제어 문자는 이스케이프)
+static void writeJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') out << '\\' << *c;
+        else if (static_cast<unsigned char>(*c) < 0x20) out << ' ';
+        else out << *c;
+    }
+    out << '"';
+}
+
+// {"traceEvents": [{"name", "cat", "ph": "X", "ts", "dur", "pid", "tid"}, ...], "displayTimeUnit": "ms"}
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Error: Could not open trace file: " << path << std::endl;
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\":[\n";
+    for (std::size_t i = 0; i < m_events.size(); ++i) {
+        const TraceEvent& e = m_events[i];
+        out << "{\"name\":";
+        writeJsonString(out, e.name);
+        out << ",\"cat\":";
+        writeJsonString(out, e.category);
+        out << ",\"ph\":\"X\",\"ts\":" << e.start << ",\"dur\":" << e.duration << ",\"pid\":1,\"tid\":" << e.thread << '}';
+        out << (i + 1 < m_events.size() ? ",\n" : "\n");
+    }
+    out << "],\"displayTimeUnit\":\"ms\"}\n";
+    return static_cast<bool>(out);
+}
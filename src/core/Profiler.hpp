@@ -0,0 +1,119 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <vector>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// 구간 하나의 최근 통계 (오버레이 표시용)
+struct ProfileSectionStats {
+    std::string category;               // 분류 (화면 이름, "worker" 등)
+    std::string name;                   // 구간 이름
+    double p50 = 0.0, p99 = 0.0;        // 최근 WINDOW개 측정의 중앙값, 99백분위 (초)
+    double last = 0.0;                  // 마지막 측정 (초)
+    std::uint64_t count = 0;            // 전체 측정 횟수
+    std::vector<std::uint32_t> histogram; // 최근 측정의 로그 구간 분포 (HISTOGRAM_BINS개, 구간 k = 2^k ~ 2^(k+1) μs)
+};
+
+// 프레임 구간 프로파일러 (SFML 비의존 코어, 프로세스 전체에 하나)
+// PROFILE_SCOPE로 감싼 구간의 시간을 구간별 최근 WINDOW개 링 버퍼에 모아 p50/p99와 분포를 계산하고,
+// 캡처 중에는 Chrome trace-event 형식("ph": "X" 완료 이벤트)으로 기록해 chrome://tracing, Perfetto에서 볼 수 있게 내보냄
+// - 빌드 시 IAPS_PROFILER가 정의되지 않으면 PROFILE_SCOPE는 아무 코드도 만들지 않음
+// - 정의되어 있어도 꺼져 있으면 구간마다 원자 변수 읽기와 분기 한 번뿐 (시계를 읽지 않음)
+// 여러 스레드(화면, 시뮬레이션 작업자, 스레드 풀)에서 기록할 수 있으며, 기록은 뮤텍스 하나로 보호
+// (구간은 프레임당 수십 개 수준이라 경합이 거의 없음)
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static Profiler& instance();
+
+    void setEnabled(bool enabled);
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    // 구간 하나 기록 (category, name은 프로그램이 끝날 때까지 유효한 문자열 리터럴)
+    void record(const char* category, const char* name, Clock::time_point start, Clock::time_point end);
+
+    // 구간별 최근 통계 (처음 기록된 순서)
+    std::vector<ProfileSectionStats> stats() const;
+    // 통계와 캡처를 모두 비움
+    void clear();
+
+    // trace 캡처 시작/종료 (시작하면 이전 캡처는 버림, MAX_TRACE_EVENTS개를 넘으면 이후 이벤트는 버림)
+    void beginCapture();
+    void endCapture();
+    bool capturing() const;
+    std::size_t capturedEvents() const;
+    // 캡처한 이벤트를 Chrome trace-event JSON으로 저장 (실패하면 false)
+    bool writeChromeTrace(const std::string& path) const;
+
+    static const std::size_t WINDOW;           // 구간별로 통계에 쓰는 최근 측정 수
+    static const std::size_t MAX_TRACE_EVENTS; // 캡처 최대 이벤트 수
+    static const int HISTOGRAM_BINS;           // 분포 구간 수 (마지막 구간은 그 이상 전부)
+
+private:
+    // 구간별 링 버퍼
+    struct Section {
+        const char* category;
+        const char* name;
+        std::vector<float> samples; // 최근 측정 (초, WINDOW개까지)
+        std::size_t next;           // 다음에 덮어쓸 위치
+        std::uint64_t count;
+        float last;
+    };
+    // 캡처한 완료 이벤트 하나
+    struct TraceEvent {
+        const char* category;
+        const char* name;
+        double start, duration;     // 기준 시각 이후 μs
+        std::uint32_t thread;       // 기록한 스레드 번호 (처음 기록한 순서)
+    };
+
+    Profiler();
+
+    std::atomic<bool> m_enabled;
+    std::atomic<bool> m_capturing;
+    Clock::time_point m_epoch;         // trace 시각 기준
+    mutable std::mutex m_mutex;        // 아래 상태 보호
+    std::vector<Section> m_sections;
+    std::vector<TraceEvent> m_events;
+
+    Section& section(const char* category, const char* name); // 없으면 추가 (m_mutex 잠근 상태에서 호출)
+    static std::uint32_t threadNumber();
+};
+
+// 생성부터 소멸까지를 한 구간으로 기록하는 범위 타이머 (프로파일러가 꺼져 있으면 시계를 읽지 않음)
+class ProfileScope {
+public:
+    ProfileScope(const char* category, const char* name)
+        : m_category(category), m_name(name), m_active(Profiler::instance().enabled()) {
+        if (m_active) m_start = Profiler::Clock::now();
+    }
+    ~ProfileScope() {
+        if (m_active) Profiler::instance().record(m_category, m_name, m_start, Profiler::Clock::now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_category;
+    const char* m_name;
+    bool m_active;
+    Profiler::Clock::time_point m_start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#ifdef IAPS_PROFILER
+// 현재 범위 끝까지를 category/name 구간으로 기록
+#define PROFILE_SCOPE(category, name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(category, name)
+#else
+#define PROFILE_SCOPE(category, name) ((void)0)
+#endif
+
+#endif
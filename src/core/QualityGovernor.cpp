@@ -0,0 +1,80 @@
+#include "QualityGovernor.hpp"
+#include <algorithm>
+#include <cmath>
+
+const double QualityGovernor::DEFAULT_BUDGET = 1.0 / 60.0;
+const double QualityGovernor::PERCENTILE = 0.95;
+const std::size_t QualityGovernor::WINDOW = 60;       // 60 FPS에서 약 1초
+const double QualityGovernor::UPGRADE_HEADROOM = 0.6; // 다음 단계는 대략 2 ~ 4배 무거우므로 충분한 여유가 있을 때만
+const int QualityGovernor::UPGRADE_WINDOWS = 3;
+const int QualityGovernor::DOWNGRADE_COOLDOWN = 10;
+const int QualityGovernor::DEFAULT_LEVEL = 2;         // 중간 단계에서 시작해 장비에 맞게 오르내림
+const int QualityGovernor::SETTLE_FRAMES = 10;
+
+// 단계별 설정: 파티클 수와 격자 셀 수를 함께 늘리고, 낮은 단계에서는 텍스트도 덜 자주 갱신
+// ("높음"이 기존 고정 설정과 같은 격자 해상도)
+static const QualityLevel LEVELS[] = {
+    {L"최저", 250, 24, 0.5f},
+    {L"낮음", 1000, 32, 0.25f},
+    {L"보통", 5000, 48, 0.1f},
+    {L"높음", 20000, 64, 0.05f},
+    {L"최고", 100000, 96, 0.f},
+};
+static const int LEVEL_COUNT = static_cast<int>(sizeof(LEVELS) / sizeof(LEVELS[0]));
+
+QualityGovernor::QualityGovernor(double budgetSeconds)
+    : m_budget(budgetSeconds), m_level(DEFAULT_LEVEL), m_lastPercentile(0.0), m_headroomWindows(0), m_cooldownWindows(0), m_settleFrames(0) {
+    m_samples.reserve(WINDOW);
+}
+
+void QualityGovernor::setBudget(double seconds) { m_budget = seconds; }
+double QualityGovernor::budget() const { return m_budget; }
+
+bool QualityGovernor::recordFrame(double seconds) {
+    if (m_settleFrames > 0) { --m_settleFrames; return false; }
+    m_samples.push_back(seconds);
+    if (m_samples.size() < WINDOW) return false;
+
+    // 창의 백분위 값 (nth_element로 O(WINDOW))
+    std::size_t rank = std::min(m_samples.size() - 1, static_cast<std::size_t>(std::ceil(PERCENTILE * m_samples.size())) - 1);
+    std::nth_element(m_samples.begin(), m_samples.begin() + rank, m_samples.end());
+    m_lastPercentile = m_samples[rank];
+    m_samples.clear();
+    if (m_cooldownWindows > 0) --m_cooldownWindows;
+
+    if (m_lastPercentile > m_budget) {
+        m_headroomWindows = 0;
+        if (m_level == 0) return false;
+        changeLevel(m_level - 1);
+        m_cooldownWindows = DOWNGRADE_COOLDOWN;
+        return true;
+    }
+    if (m_lastPercentile < m_budget * UPGRADE_HEADROOM) {
+        if (++m_headroomWindows >= UPGRADE_WINDOWS && m_cooldownWindows == 0 && m_level + 1 < LEVEL_COUNT) {
+            changeLevel(m_level + 1);
+            return true;
+        }
+    } else {
+        m_headroomWindows = 0;
+    }
+    return false;
+}
+
+void QualityGovernor::setLevel(int level) {
+    changeLevel(std::clamp(level, 0, LEVEL_COUNT - 1));
+    m_cooldownWindows = 0;
+}
+
+// 단계 변경: 이전 단계에서 모은 여유 창 수와 표본은 새 단계에 해당하지 않으므로 버림
+void QualityGovernor::changeLevel(int level) {
+    m_level = level;
+    m_headroomWindows = 0;
+    m_samples.clear();
+    m_settleFrames = SETTLE_FRAMES;
+}
+
+int QualityGovernor::level() const { return m_level; }
+const QualityLevel& QualityGovernor::settings() const { return LEVELS[m_level]; }
+double QualityGovernor::lastPercentile() const { return m_lastPercentile; }
+int QualityGovernor::levelCount() { return LEVEL_COUNT; }
+const QualityLevel& QualityGovernor::levelSettings(int level) { return LEVELS[std::clamp(level, 0, LEVEL_COUNT - 1)]; }
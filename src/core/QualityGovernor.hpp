@@ -0,0 +1,62 @@
+#ifndef QUALITY_GOVERNOR_HPP
+#define QUALITY_GOVERNOR_HPP
+
+#include <vector>
+#include <cstddef>
+
+// 화질 단계 하나의 설정
+struct QualityLevel {
+    const wchar_t* name;         // UI 표시 이름
+    std::size_t maxParticles;    // 최대 파티클 수
+    int fieldResolution;         // 농도장 격자 해상도 (가장 긴 축 셀 수)
+    float textRefreshInterval;   // 표시 텍스트 갱신 간격 (초, 0이면 새 상태마다)
+};
+
+// 프레임 시간 예산을 지키도록 화질 단계를 조절하는 적응형 조정기 (SFML 비의존 코어)
+// 프레임마다 작업 시간(프레임 제한 대기 제외)을 기록하고, WINDOW 프레임이 모이면 PERCENTILE 백분위 값을 예산과 비교
+// - 예산을 넘으면 바로 한 단계 낮춤
+// - 예산의 UPGRADE_HEADROOM 배 미만이 UPGRADE_WINDOWS 창 연속이면 한 단계 높임
+//   (낮춘 직후 DOWNGRADE_COOLDOWN 창 동안은 높이지 않아 두 단계 사이를 오가지 않음)
+// 단계가 바뀌면 모은 표본을 버리고, 재구성(격자, 버퍼) 비용이 섞이는 처음 SETTLE_FRAMES 프레임은 세지 않음
+class QualityGovernor {
+public:
+    // 생성자: 프레임 시간 예산 (초)
+    explicit QualityGovernor(double budgetSeconds = DEFAULT_BUDGET);
+
+    void setBudget(double seconds);
+    double budget() const;
+
+    // 프레임 하나의 작업 시간(초)을 기록, 화질 단계가 바뀌었으면 true
+    bool recordFrame(double seconds);
+    // 단계를 직접 지정 (0 ~ levelCount() - 1, 범위 밖은 제한), 모은 표본은 버림
+    void setLevel(int level);
+
+    int level() const;                       // 현재 화질 단계 (0 = 최저)
+    const QualityLevel& settings() const;    // 현재 단계의 설정
+    double lastPercentile() const;           // 마지막으로 평가한 창의 백분위 프레임 시간 (초, 아직 없으면 0)
+
+    static int levelCount();
+    static const QualityLevel& levelSettings(int level);
+
+    static const double DEFAULT_BUDGET;      // 기본 예산 (초, 60 FPS)
+    static const double PERCENTILE;          // 평가 백분위 (0 ~ 1)
+    static const std::size_t WINDOW;         // 평가 창 크기 (프레임 수)
+    static const double UPGRADE_HEADROOM;    // 단계를 높일 수 있는 여유 (예산 대비 비율)
+    static const int UPGRADE_WINDOWS;        // 단계를 높이기 전에 필요한 연속 여유 창 수
+    static const int DOWNGRADE_COOLDOWN;     // 단계를 낮춘 뒤 높이지 않는 창 수
+    static const int DEFAULT_LEVEL;          // 시작 단계
+    static const int SETTLE_FRAMES;          // 단계 변경 직후 세지 않는 프레임 수
+
+private:
+    double m_budget;
+    int m_level;
+    std::vector<double> m_samples; // 현재 창의 프레임 시간 (초)
+    double m_lastPercentile;
+    int m_headroomWindows;         // 연속으로 여유가 있었던 창 수
+    int m_cooldownWindows;         // 단계를 높이지 않고 남은 창 수
+    int m_settleFrames;            // 단계 변경 후 아직 세지 않을 프레임 수
+
+    void changeLevel(int level);
+};
+
+#endif
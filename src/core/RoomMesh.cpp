@@ -0,0 +1,425 @@
+#include "RoomMesh.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+const int RoomMesh::MASK_RESOLUTION = 64;
+const float RoomMesh::FEATURE_ANGLE_COS = 0.985f; // 약 10도
+
+// 정점 인덱스 세 개로 된 삼각형
+struct MeshTriangle {
+    std::uint32_t a, b, c;
+};
+
+// 마스크 열 중심을 복셀 중심에서 살짝 어긋나게 해 광선이 모서리/정점을 정확히 지나 두 번 세는 경우를 피함 (복셀 크기 비율)
+static const float COLUMN_OFFSET_X = 0.000618f;
+static const float COLUMN_OFFSET_Z = 0.000414f;
+
+static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+static const char* skipSpaces(const char* p, const char* end) {
+    while (p < end && isSpace(*p)) ++p;
+    return p;
+}
+
+// 파일 전체를 문자열로 읽기
+static bool readWholeFile(const std::string& filename, std::string& data) {
+    std::ifstream inFile(filename, std::ios::binary | std::ios::ate);
+    if (!inFile.is_open()) {
+        std::cerr << "Error: Could not open room mesh file: " << filename << std::endl;
+        return false;
+    }
+    data.resize(static_cast<std::size_t>(inFile.tellg()));
+    inFile.seekg(0);
+    if (!inFile.read(data.data(), static_cast<std::streamsize>(data.size()))) {
+        std::cerr << "Error: Could not read room mesh file: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// OBJ: "v x y z"와 "f i j k ..." 줄만 사용 (인덱스는 1부터, 음수는 뒤에서부터, "i/t/n" 형식은 앞 번호만)
+static bool parseObj(const std::string& text, const std::string& filename, std::vector<Vec3D>& vertices, std::vector<MeshTriangle>& triangles) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    std::size_t lineNo = 0;
+    std::vector<long long> polygon;
+    auto fail = [&]() {
+        std::cerr << "Error: Invalid OBJ line " << lineNo << " in room mesh file: " << filename << std::endl;
+        return false;
+    };
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+        if (!lineEnd) lineEnd = end;
+        ++lineNo;
+        const char* q = skipSpaces(p, lineEnd);
+        if (lineEnd - q >= 2 && q[0] == 'v' && isSpace(q[1])) {
+            float c[3];
+            q += 1;
+            for (float& value : c) {
+                q = skipSpaces(q, lineEnd);
+                auto result = std::from_chars(q, lineEnd, value);
+                if (result.ec != std::errc() || !std::isfinite(value)) return fail();
+                q = result.ptr;
+            }
+            vertices.push_back({c[0], c[1], c[2]});
+        } else if (lineEnd - q >= 2 && q[0] == 'f' && isSpace(q[1])) {
+            polygon.clear();
+            q += 1;
+            while ((q = skipSpaces(q, lineEnd)) < lineEnd) {
+                long long index = 0;
+                auto result = std::from_chars(q, lineEnd, index);
+                if (result.ec != std::errc() || index == 0) return fail();
+                q = result.ptr;
+                while (q < lineEnd && !isSpace(*q)) ++q; // 텍스처/법선 번호 건너뜀
+                long long resolved = index > 0 ? index - 1 : static_cast<long long>(vertices.size()) + index;
+                if (resolved < 0 || resolved > UINT32_MAX) return fail(); // 32비트로 자르면 작은 유효 인덱스로 바뀜
+                polygon.push_back(resolved); // 양수 인덱스는 뒤에 나오는 정점을 가리킬 수 있어 끝에서 검사
+            }
+            if (polygon.size() < 3) return fail();
+            for (std::size_t k = 1; k + 1 < polygon.size(); ++k) {
+                triangles.push_back({static_cast<std::uint32_t>(polygon[0]), static_cast<std::uint32_t>(polygon[k]), static_cast<std::uint32_t>(polygon[k + 1])});
+            }
+        }
+        p = lineEnd + 1;
+    }
+    return true;
+}
+
+// PLY 속성 하나 (목록이면 개수 형식과 항목 형식)
+struct PlyProperty {
+    std::string name;
+    std::string type;      // 스칼라 형식 또는 목록 항목 형식
+    std::string countType; // 목록 개수 형식 (스칼라면 빈 문자열)
+};
+struct PlyElement {
+    std::string name;
+    std::size_t count = 0;
+    std::vector<PlyProperty> properties;
+};
+
+// 형식 이름의 바이트 크기 (모르는 형식이면 0)
+static std::size_t plyTypeSize(const std::string& type) {
+    if (type == "char" || type == "uchar" || type == "int8" || type == "uint8") return 1;
+    if (type == "short" || type == "ushort" || type == "int16" || type == "uint16") return 2;
+    if (type == "int" || type == "uint" || type == "int32" || type == "uint32" || type == "float" || type == "float32") return 4;
+    if (type == "double" || type == "float64") return 8;
+    return 0;
+}
+
+// PLY 본문에서 값 하나씩 읽기 (ascii는 공백으로 구분된 수, binary_little_endian은 형식 크기만큼)
+struct PlyReader {
+    bool binary;
+    const char* p;
+    const char* end;
+
+    bool read(const std::string& type, double& value) {
+        if (!binary) {
+            while (p < end && (isSpace(*p) || *p == '\n')) ++p;
+            auto result = std::from_chars(p, end, value);
+            if (result.ec != std::errc()) return false;
+            p = result.ptr;
+            return true;
+        }
+        std::size_t size = plyTypeSize(type);
+        if (size == 0 || static_cast<std::size_t>(end - p) < size) return false;
+        unsigned char bytes[8];
+        std::memcpy(bytes, p, size);
+        p += size;
+        if (type == "char" || type == "int8") value = static_cast<std::int8_t>(bytes[0]);
+        else if (type == "uchar" || type == "uint8") value = bytes[0];
+        else if (type == "short" || type == "int16") { std::int16_t v; std::memcpy(&v, bytes, 2); value = v; }
+        else if (type == "ushort" || type == "uint16") { std::uint16_t v; std::memcpy(&v, bytes, 2); value = v; }
+        else if (type == "int" || type == "int32") { std::int32_t v; std::memcpy(&v, bytes, 4); value = v; }
+        else if (type == "uint" || type == "uint32") { std::uint32_t v; std::memcpy(&v, bytes, 4); value = v; }
+        else if (type == "float" || type == "float32") { float v; std::memcpy(&v, bytes, 4); value = v; }
+        else { double v; std::memcpy(&v, bytes, 8); value = v; }
+        return true;
+    }
+};
+
+// PLY: vertex 요소의 x/y/z와 face 요소의 vertex_indices(vertex_index) 목록만 사용, 다른 요소/속성은 건너뜀
+static bool parsePly(const std::string& text, const std::string& filename, std::vector<Vec3D>& vertices, std::vector<MeshTriangle>& triangles) {
+    auto fail = [&](const char* what) {
+        std::cerr << "Error: " << what << " in room mesh file: " << filename << std::endl;
+        return false;
+    };
+    std::size_t headerEnd = text.find("end_header");
+    if (headerEnd == std::string::npos) return fail("Missing PLY end_header");
+    std::size_t bodyStart = text.find('\n', headerEnd);
+    if (bodyStart == std::string::npos) return fail("Missing PLY body");
+    std::istringstream header(text.substr(0, headerEnd));
+    std::vector<PlyElement> elements;
+    std::string line, format;
+    while (std::getline(header, line)) {
+        std::istringstream ss(line);
+        std::string key;
+        ss >> key;
+        if (key == "format") {
+            ss >> format;
+        } else if (key == "element") {
+            PlyElement element;
+            if (!(ss >> element.name >> element.count)) return fail("Invalid PLY element line");
+            elements.push_back(element);
+        } else if (key == "property") {
+            if (elements.empty()) return fail("PLY property before any element");
+            PlyProperty property;
+            std::string first;
+            ss >> first;
+            if (first == "list") ss >> property.countType >> property.type >> property.name;
+            else { property.type = first; ss >> property.name; }
+            if (plyTypeSize(property.type) == 0 || (!property.countType.empty() && plyTypeSize(property.countType) == 0)) return fail("Unknown PLY property type");
+            elements.back().properties.push_back(property);
+        }
+    }
+    if (format != "ascii" && format != "binary_little_endian") return fail("Unsupported PLY format (only ascii and binary_little_endian)");
+
+    PlyReader reader{format != "ascii", text.data() + bodyStart + 1, text.data() + text.size()};
+    std::vector<std::uint32_t> polygon;
+    for (const PlyElement& element : elements) {
+        bool isVertex = element.name == "vertex", isFace = element.name == "face";
+        for (std::size_t r = 0; r < element.count; ++r) {
+            Vec3D v{0.f, 0.f, 0.f};
+            polygon.clear();
+            for (const PlyProperty& property : element.properties) {
+                double value = 0.0;
+                if (property.countType.empty()) {
+                    if (!reader.read(property.type, value)) return fail("Truncated PLY body");
+                    if (isVertex && property.name == "x") v.x = static_cast<float>(value);
+                    else if (isVertex && property.name == "y") v.y = static_cast<float>(value);
+                    else if (isVertex && property.name == "z") v.z = static_cast<float>(value);
+                    continue;
+                }
+                double count = 0.0;
+                if (!reader.read(property.countType, count) || count < 0.0) return fail("Truncated PLY body");
+                bool indices = isFace && (property.name == "vertex_indices" || property.name == "vertex_index");
+                for (std::size_t k = 0; k < static_cast<std::size_t>(count); ++k) {
+                    if (!reader.read(property.type, value)) return fail("Truncated PLY body");
+                    if (indices) {
+                        if (value < 0.0) return fail("Negative PLY vertex index");
+                        if (value > UINT32_MAX) return fail("PLY vertex index out of range");
+                        polygon.push_back(static_cast<std::uint32_t>(value));
+                    }
+                }
+            }
+            if (isVertex) {
+                if (!std::isfinite(v.x) || !std::isfinite(v.y) || !std::isfinite(v.z)) return fail("Non-finite PLY vertex");
+                vertices.push_back(v);
+            }
+            if (isFace) {
+                if (polygon.size() < 3) return fail("PLY face with fewer than 3 vertices");
+                for (std::size_t k = 1; k + 1 < polygon.size(); ++k) triangles.push_back({polygon[0], polygon[k], polygon[k + 1]});
+            }
+        }
+    }
+    return true;
+}
+
+RoomMesh::RoomMesh()
+    : m_width(1.f), m_depth(1.f), m_height(1.f), m_volume(1.f), m_triangleCount(0), m_openEdgeCount(0),
+      m_maskX(0), m_maskY(0), m_maskZ(0), m_maskFraction(1.f) {}
+
+// 파싱 → 경계 상자/부피 → 윤곽선 → 복셀 마스크 순서로 임시 객체를 만든 뒤 성공하면 반영
+bool RoomMesh::loadFromFile(const std::string& filename) {
+    std::string text;
+    if (!readWholeFile(filename, text)) return false;
+    std::vector<Vec3D> vertices;
+    std::vector<MeshTriangle> triangles;
+    bool isPly = text.compare(0, 3, "ply") == 0 && text.size() > 3 && (text[3] == '\n' || text[3] == '\r');
+    if (!(isPly ? parsePly(text, filename, vertices, triangles) : parseObj(text, filename, vertices, triangles))) return false;
+    text.clear();
+    text.shrink_to_fit();
+    if (triangles.empty()) {
+        std::cerr << "Error: No faces in room mesh file: " << filename << std::endl;
+        return false;
+    }
+    for (const MeshTriangle& t : triangles) {
+        if (t.a >= vertices.size() || t.b >= vertices.size() || t.c >= vertices.size()) {
+            std::cerr << "Error: Face refers to a missing vertex in room mesh file: " << filename << std::endl;
+            return false;
+        }
+    }
+
+    RoomMesh mesh;
+    mesh.m_filename = filename;
+    mesh.m_triangleCount = triangles.size();
+
+    // 경계 상자 (면이 쓰는 정점만)
+    Vec3D lo = vertices[triangles[0].a], hi = lo;
+    for (const MeshTriangle& t : triangles) {
+        for (std::uint32_t index : {t.a, t.b, t.c}) {
+            const Vec3D& v = vertices[index];
+            lo = {std::min(lo.x, v.x), std::min(lo.y, v.y), std::min(lo.z, v.z)};
+            hi = {std::max(hi.x, v.x), std::max(hi.y, v.y), std::max(hi.z, v.z)};
+        }
+    }
+    mesh.m_width = hi.x - lo.x;
+    mesh.m_height = hi.y - lo.y;
+    mesh.m_depth = hi.z - lo.z;
+    if (!(mesh.m_width > 0.f && mesh.m_height > 0.f && mesh.m_depth > 0.f)) {
+        std::cerr << "Error: Room mesh is flat along an axis: " << filename << std::endl;
+        return false;
+    }
+    const double cx = 0.5 * (lo.x + hi.x), cy = 0.5 * (lo.y + hi.y), cz = 0.5 * (lo.z + hi.z);
+
+    // 부호 있는 사면체 부피 합 (경계 상자 중심을 꼭짓점으로, 반올림 오차를 줄이려고 double로 누적)
+    // 법선 방향 계산용 면 법선(단위 벡터, 넓이가 0이면 0 벡터)도 함께 구함
+    double signedVolume = 0.0;
+    std::vector<Vec3D> normals(triangles.size());
+    for (std::size_t f = 0; f < triangles.size(); ++f) {
+        const Vec3D& va = vertices[triangles[f].a];
+        const Vec3D& vb = vertices[triangles[f].b];
+        const Vec3D& vc = vertices[triangles[f].c];
+        double ax = va.x - cx, ay = va.y - cy, az = va.z - cz;
+        double bx = vb.x - cx, by = vb.y - cy, bz = vb.z - cz;
+        double qx = vc.x - cx, qy = vc.y - cy, qz = vc.z - cz;
+        signedVolume += ax * (by * qz - bz * qy) - ay * (bx * qz - bz * qx) + az * (bx * qy - by * qx);
+        double ux = bx - ax, uy = by - ay, uz = bz - az, wx = qx - ax, wy = qy - ay, wz = qz - az;
+        double nx = uy * wz - uz * wy, ny = uz * wx - ux * wz, nz = ux * wy - uy * wx;
+        double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+        normals[f] = length > 0.0 ? Vec3D{static_cast<float>(nx / length), static_cast<float>(ny / length), static_cast<float>(nz / length)}
+                                  : Vec3D{0.f, 0.f, 0.f};
+    }
+    double boxVolume = static_cast<double>(mesh.m_width) * mesh.m_height * mesh.m_depth;
+    mesh.m_volume = static_cast<float>(std::fabs(signedVolume) / 6.0);
+    if (mesh.m_volume <= boxVolume * 1e-6) {
+        std::cerr << "Error: Room mesh encloses no volume (is it a closed surface?): " << filename << std::endl;
+        return false;
+    }
+
+    // 파일 좌표 → 정규화 로컬 좌표 (y는 위아래를 뒤집음)
+    auto toLocal = [&](const Vec3D& v) {
+        return Vec3D{static_cast<float>((v.x - cx) / mesh.m_width), static_cast<float>(-(v.y - cy) / mesh.m_height),
+                     static_cast<float>((v.z - cz) / mesh.m_depth)};
+    };
+
+    // 모서리 중복 제거: (작은 정점, 큰 정점) 키와 삼각형 번호를 정렬해 같은 키끼리 모음
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> halfEdges;
+    halfEdges.reserve(triangles.size() * 3);
+    for (std::size_t f = 0; f < triangles.size(); ++f) {
+        const std::uint32_t corner[3] = {triangles[f].a, triangles[f].b, triangles[f].c};
+        for (int e = 0; e < 3; ++e) {
+            std::uint32_t u = corner[e], w = corner[(e + 1) % 3];
+            if (u == w) continue;
+            std::uint64_t key = (static_cast<std::uint64_t>(std::min(u, w)) << 32) | std::max(u, w);
+            halfEdges.push_back({key, static_cast<std::uint32_t>(f)});
+        }
+    }
+    std::sort(halfEdges.begin(), halfEdges.end());
+    std::vector<int> outlineIndex(vertices.size(), -1);
+    auto outlineVertex = [&](std::uint32_t v) {
+        if (outlineIndex[v] < 0) {
+            outlineIndex[v] = static_cast<int>(mesh.m_outlineVertices.size());
+            mesh.m_outlineVertices.push_back(toLocal(vertices[v]));
+        }
+        return outlineIndex[v];
+    };
+    for (std::size_t first = 0; first < halfEdges.size();) {
+        std::size_t last = first;
+        while (last < halfEdges.size() && halfEdges[last].first == halfEdges[first].first) ++last;
+        bool keep = true;
+        if (last - first == 2) { // 두 면이 공유하는 모서리: 거의 평평하면 같은 면의 분할선이므로 뺌
+            const Vec3D& n0 = normals[halfEdges[first].second];
+            const Vec3D& n1 = normals[halfEdges[first + 1].second];
+            keep = n0.x * n1.x + n0.y * n1.y + n0.z * n1.z < FEATURE_ANGLE_COS;
+        } else {
+            ++mesh.m_openEdgeCount;
+        }
+        if (keep) {
+            std::uint64_t key = halfEdges[first].first;
+            int a = outlineVertex(static_cast<std::uint32_t>(key >> 32));
+            int b = outlineVertex(static_cast<std::uint32_t>(key & 0xFFFFFFFFu));
+            mesh.m_outlineEdges.push_back({a, b});
+        }
+        first = last;
+    }
+    if (mesh.m_openEdgeCount > 0) {
+        std::cerr << "Warning: Room mesh has " << mesh.m_openEdgeCount << " edges not shared by exactly two faces; "
+                  << "volume and containment may be inaccurate: " << filename << std::endl;
+    }
+
+    // 복셀 마스크: 각 (x, z) 열 중심에서 y축 방향 광선이 삼각형과 만나는 높이를 모은 뒤, 정렬해 두 개씩 짝지은 구간을 안쪽으로 채움
+    float maxExtent = std::max({mesh.m_width, mesh.m_depth, mesh.m_height});
+    auto cells = [&](float extent) { return std::max(1, static_cast<int>(std::lround(MASK_RESOLUTION * extent / maxExtent))); };
+    mesh.m_maskX = cells(mesh.m_width);
+    mesh.m_maskY = cells(mesh.m_height);
+    mesh.m_maskZ = cells(mesh.m_depth);
+    const int nx = mesh.m_maskX, ny = mesh.m_maskY, nz = mesh.m_maskZ;
+    std::vector<std::pair<std::uint32_t, float>> crossings; // (열 번호 k * nx + i, 교차 높이)
+    for (const MeshTriangle& t : triangles) {
+        Vec3D a = toLocal(vertices[t.a]), b = toLocal(vertices[t.b]), c = toLocal(vertices[t.c]);
+        float area2 = (b.x - a.x) * (c.z - a.z) - (c.x - a.x) * (b.z - a.z);
+        if (area2 == 0.f) continue; // 광선과 나란한 삼각형 (수직 벽)
+        auto columnRange = [](float lo, float hi, int n, float offset, int& first, int& last) {
+            first = std::max(0, static_cast<int>(std::ceil((lo + 0.5f) * n - 0.5f - offset)));
+            last = std::min(n - 1, static_cast<int>(std::floor((hi + 0.5f) * n - 0.5f - offset)));
+        };
+        int i0, i1, k0, k1;
+        columnRange(std::min({a.x, b.x, c.x}), std::max({a.x, b.x, c.x}), nx, COLUMN_OFFSET_X, i0, i1);
+        columnRange(std::min({a.z, b.z, c.z}), std::max({a.z, b.z, c.z}), nz, COLUMN_OFFSET_Z, k0, k1);
+        for (int k = k0; k <= k1; ++k) {
+            float pz = -0.5f + (k + 0.5f + COLUMN_OFFSET_Z) / nz;
+            for (int i = i0; i <= i1; ++i) {
+                float px = -0.5f + (i + 0.5f + COLUMN_OFFSET_X) / nx;
+                float w0 = ((b.x - px) * (c.z - pz) - (c.x - px) * (b.z - pz)) / area2;
+                float w1 = ((c.x - px) * (a.z - pz) - (a.x - px) * (c.z - pz)) / area2;
+                float w2 = 1.f - w0 - w1;
+                if (w0 < 0.f || w1 < 0.f || w2 < 0.f) continue;
+                crossings.push_back({static_cast<std::uint32_t>(k * nx + i), w0 * a.y + w1 * b.y + w2 * c.y});
+            }
+        }
+    }
+    std::sort(crossings.begin(), crossings.end());
+    mesh.m_mask.assign(static_cast<std::size_t>(nx) * ny * nz, 0);
+    std::size_t inside = 0;
+    for (std::size_t first = 0; first < crossings.size();) {
+        std::size_t last = first;
+        while (last < crossings.size() && crossings[last].first == crossings[first].first) ++last;
+        int i = static_cast<int>(crossings[first].first % nx), k = static_cast<int>(crossings[first].first / nx);
+        for (std::size_t m = first; m + 1 < last; m += 2) { // 홀수 개(열린 모델)면 마지막 교차는 무시
+            int j0 = std::max(0, static_cast<int>(std::ceil((crossings[m].second + 0.5f) * ny - 0.5f)));
+            int j1 = std::min(ny - 1, static_cast<int>(std::floor((crossings[m + 1].second + 0.5f) * ny - 0.5f)));
+            for (int j = j0; j <= j1; ++j) {
+                std::uint8_t& cell = mesh.m_mask[(static_cast<std::size_t>(k) * ny + j) * nx + i];
+                inside += cell == 0;
+                cell = 1;
+            }
+        }
+        first = last;
+    }
+    if (inside == 0) { // 복셀보다 얇은 모델: 포함 판정 없이 경계 상자 전체를 방으로 봄
+        std::cerr << "Warning: Room mesh is thinner than the containment grid, using its bounding box: " << filename << std::endl;
+        std::fill(mesh.m_mask.begin(), mesh.m_mask.end(), 1);
+        inside = mesh.m_mask.size();
+    }
+    mesh.m_maskFraction = static_cast<float>(inside) / static_cast<float>(mesh.m_mask.size());
+
+    *this = std::move(mesh);
+    return true;
+}
+
+const std::string& RoomMesh::filename() const { return m_filename; }
+float RoomMesh::width() const { return m_width; }
+float RoomMesh::depth() const { return m_depth; }
+float RoomMesh::height() const { return m_height; }
+float RoomMesh::volume() const { return m_volume; }
+float RoomMesh::fillFraction() const { return m_volume / (m_width * m_depth * m_height); }
+std::size_t RoomMesh::triangleCount() const { return m_triangleCount; }
+std::size_t RoomMesh::openEdgeCount() const { return m_openEdgeCount; }
+const std::vector<Vec3D>& RoomMesh::outlineVertices() const { return m_outlineVertices; }
+const std::vector<Edge>& RoomMesh::outlineEdges() const { return m_outlineEdges; }
+float RoomMesh::maskFraction() const { return m_maskFraction; }
+
+bool RoomMesh::contains(const Vec3D& local) const {
+    if (m_mask.empty()) return std::fabs(local.x) <= 0.5f && std::fabs(local.y) <= 0.5f && std::fabs(local.z) <= 0.5f;
+    if (!(std::fabs(local.x) <= 0.5f && std::fabs(local.y) <= 0.5f && std::fabs(local.z) <= 0.5f)) return false;
+    int i = std::min(static_cast<int>((local.x + 0.5f) * m_maskX), m_maskX - 1);
+    int j = std::min(static_cast<int>((local.y + 0.5f) * m_maskY), m_maskY - 1);
+    int k = std::min(static_cast<int>((local.z + 0.5f) * m_maskZ), m_maskZ - 1);
+    return m_mask[(static_cast<std::size_t>(k) * m_maskY + j) * m_maskX + i] != 0;
+}
@@ -0,0 +1,64 @@
+#ifndef ROOM_MESH_HPP
+#define ROOM_MESH_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "Geometry.hpp"
+
+// OBJ/PLY 파일에서 가져온 닫힌 다면체 방 (SFML 비의존 코어)
+// 파일 좌표는 m 단위, +y가 위쪽이라고 보고, 경계 상자를 정규화 로컬 좌표(-0.5 ~ 0.5, 화면 아래쪽이 +y)로 옮겨 둠
+// 따라서 방 크기(경계 상자 가로/세로/높이)를 바꾸면 모델도 그 비율로 늘어나고, 부피는 채움 비율 × 경계 상자 부피
+// 불러올 때 한 번만:
+//   - 부피: 부호 있는 사면체 부피 합 (경계 상자 중심 기준, 법선 방향이 뒤집힌 모델도 절댓값 사용)
+//   - 윤곽선: 삼각형 모서리를 정렬로 중복 제거한 뒤 인접 두 면이 거의 평평한 모서리(같은 벽의 삼각형 분할선)는 빼고,
+//             윤곽선이 쓰는 정점만 모아 둠 (RoomScene이 정점 배열 하나로 그림)
+//   - 포함 판정: y축 방향 광선의 교차 홀짝으로 채운 복셀 마스크 (가장 긴 축 MASK_RESOLUTION칸, 판정은 배열 조회 한 번)
+class RoomMesh {
+public:
+    RoomMesh();
+
+    // OBJ(v/f 줄, 다각형은 부채꼴로 삼각형 분할) 또는 PLY(ascii, binary_little_endian) 파일 불러오기
+    // 실패하면 false (오류 출력, 현재 값은 바뀌지 않음)
+    bool loadFromFile(const std::string& filename);
+
+    const std::string& filename() const;
+    // 파일 좌표 기준 경계 상자 크기 (m)
+    float width() const;
+    float depth() const;
+    float height() const;
+    // 파일 좌표 기준 부피 (m³)
+    float volume() const;
+    // 부피 / 경계 상자 부피 (방 크기를 바꿔도 유지되는 비율)
+    float fillFraction() const;
+    std::size_t triangleCount() const;
+    // 삼각형 하나에만 속하거나 셋 이상이 공유하는 모서리 수 (0이 아니면 닫힌 모델이 아님)
+    std::size_t openEdgeCount() const;
+
+    // 윤곽선 정점(정규화 로컬 좌표)과 중복 없는 모서리
+    const std::vector<Vec3D>& outlineVertices() const;
+    const std::vector<Edge>& outlineEdges() const;
+
+    // 정규화 로컬 좌표 점이 방 안에 있는지 (복셀 마스크 조회)
+    bool contains(const Vec3D& local) const;
+    // 마스크에서 방 안 복셀의 비율
+    float maskFraction() const;
+
+    static const int MASK_RESOLUTION;     // 마스크의 가장 긴 축 복셀 수
+    static const float FEATURE_ANGLE_COS; // 인접 면 법선 내적이 이보다 크면 평평한 모서리로 보고 윤곽선에서 뺌
+
+private:
+    std::string m_filename;
+    float m_width, m_depth, m_height;
+    float m_volume;
+    std::size_t m_triangleCount;
+    std::size_t m_openEdgeCount;
+    std::vector<Vec3D> m_outlineVertices;
+    std::vector<Edge> m_outlineEdges;
+    int m_maskX, m_maskY, m_maskZ;  // 축별 복셀 수
+    std::vector<std::uint8_t> m_mask; // 복셀별 안(1)/밖(0), 인덱스 (k * m_maskY + j) * m_maskX + i
+    float m_maskFraction;
+};
+
+#endif
@@ -0,0 +1,316 @@
+#include "Scenario.hpp"
+#include <cmath>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <limits>
+
+const int Scenario::FORMAT_VERSION = 2;
+const char* const Scenario::DEFAULT_FILE = "scenario.iaps";
+
+static const char* const MAGIC = "iaps-scenario"; // 첫 줄 식별자
+
+const float ScenarioOpening::WINDOW_EXCHANGE_VELOCITY = 1.25f;
+const float ScenarioOpening::PASSAGE_EXCHANGE_VELOCITY = 4.f / 7.f;
+const float ScenarioOpening::WINDOW_INFLOW_CONCENTRATION = 0.8f;
+const float ScenarioOpening::PASSAGE_INFLOW_CONCENTRATION = 10.f / 3.f;
+const float ScenarioOpening::CEILING_EXCHANGE_FACTOR = 1.5f;
+const float ScenarioOpening::FLOOR_EXCHANGE_FACTOR = 0.5f;
+const float ScenarioOpening::MIN_HALF_SIZE = 0.02f;
+
+static const float FACE_TOLERANCE = 1e-4f; // 면 위에 있다고 볼 좌표 오차 (저장/계산 반올림 여유)
+
+// 좌표 성분 접근 (0: x, 1: y, 2: z)
+static float& axisValue(Vec3D& p, int axis) { return axis == 0 ? p.x : axis == 1 ? p.y : p.z; }
+static float axisValue(const Vec3D& p, int axis) { return axis == 0 ? p.x : axis == 1 ? p.y : p.z; }
+// 면의 법선 축, 양의 방향 여부, 면 안의 u/v 축
+static int normalAxis(RoomFace face) { return static_cast<int>(face) / 2; }
+static bool positiveSide(RoomFace face) { return static_cast<int>(face) % 2 == 1; }
+static int uAxis(RoomFace face) { return normalAxis(face) == 0 ? 2 : 0; }
+static int vAxis(RoomFace face) { return normalAxis(face) == 1 ? 2 : 1; }
+static RoomFace faceOf(int axis, bool positive) { return static_cast<RoomFace>(axis * 2 + (positive ? 1 : 0)); }
+// 축 방향 방 크기 (m)
+static float roomExtent(int axis, float width, float depth, float height) { return axis == 0 ? width : axis == 1 ? height : depth; }
+
+ScenarioOpening::ScenarioOpening(OpeningKind kind, const std::array<Vec3D, 4>& corners)
+    : m_kind(kind), m_corners(corners), m_face(RoomFace::Front), m_faceArea(0.f) {
+    updateGeometry();
+}
+
+ScenarioOpening::ScenarioOpening(OpeningKind kind, const FacePlacement& placement)
+    : m_kind(kind), m_corners{}, m_face(RoomFace::Front), m_faceArea(0.f) {
+    place(placement);
+}
+
+OpeningKind ScenarioOpening::kind() const { return m_kind; }
+const std::array<Vec3D, 4>& ScenarioOpening::corners() const { return m_corners; }
+RoomFace ScenarioOpening::face() const { return m_face; }
+
+FacePlacement ScenarioOpening::placement() const {
+    int a = uAxis(m_face), b = vAxis(m_face);
+    float minU = axisValue(m_corners[0], a), maxU = minU, minV = axisValue(m_corners[0], b), maxV = minV;
+    for (const Vec3D& c : m_corners) {
+        minU = std::min(minU, axisValue(c, a)); maxU = std::max(maxU, axisValue(c, a));
+        minV = std::min(minV, axisValue(c, b)); maxV = std::max(maxV, axisValue(c, b));
+    }
+    return {m_face, (minU + maxU) * 0.5f, (minV + maxV) * 0.5f, (maxU - minU) * 0.5f, (maxV - minV) * 0.5f};
+}
+
+void ScenarioOpening::setCorners(const std::array<Vec3D, 4>& corners) {
+    m_corners = corners;
+    updateGeometry();
+}
+
+// 사각형 네 꼭짓점 (u-, v-), (u+, v-), (u+, v+), (u-, v+) 순서 (종전 통로/창문과 같은 감김 방향)
+void ScenarioOpening::place(const FacePlacement& placement) {
+    int n = normalAxis(placement.face), a = uAxis(placement.face), b = vAxis(placement.face);
+    const float su[4] = {-1.f, 1.f, 1.f, -1.f}, sv[4] = {-1.f, -1.f, 1.f, 1.f};
+    for (int i = 0; i < 4; ++i) {
+        Vec3D& c = m_corners[i];
+        axisValue(c, n) = positiveSide(placement.face) ? 0.5f : -0.5f;
+        axisValue(c, a) = placement.u + su[i] * placement.halfU;
+        axisValue(c, b) = placement.v + sv[i] * placement.halfV;
+    }
+    m_face = placement.face;
+    m_faceArea = 4.f * placement.halfU * placement.halfV;
+}
+
+// 법선 축을 뺀 두 축 평면에서 신발끈 공식으로 넓이 계산
+void ScenarioOpening::updateGeometry() {
+    if (!findFace(m_corners, m_face)) { // 면 위에 있지 않으면 평균 좌표가 가장 바깥쪽인 축의 면으로 간주
+        Vec3D mean{0.f, 0.f, 0.f};
+        for (const Vec3D& c : m_corners) { mean.x += c.x * 0.25f; mean.y += c.y * 0.25f; mean.z += c.z * 0.25f; }
+        int axis = 0;
+        for (int k = 1; k < 3; ++k) if (std::fabs(axisValue(mean, k)) > std::fabs(axisValue(mean, axis))) axis = k;
+        m_face = faceOf(axis, axisValue(mean, axis) >= 0.f);
+    }
+    int a = uAxis(m_face), b = vAxis(m_face);
+    float twiceArea = 0.f;
+    for (int i = 0; i < 4; ++i) {
+        const Vec3D& p = m_corners[i];
+        const Vec3D& q = m_corners[(i + 1) % 4];
+        twiceArea += axisValue(p, a) * axisValue(q, b) - axisValue(q, a) * axisValue(p, b);
+    }
+    m_faceArea = std::fabs(twiceArea) * 0.5f;
+}
+
+float ScenarioOpening::area(float width, float depth, float height) const {
+    return m_faceArea * roomExtent(uAxis(m_face), width, depth, height) * roomExtent(vAxis(m_face), width, depth, height);
+}
+
+float ScenarioOpening::flow(float width, float depth, float height) const {
+    float velocity = m_kind == OpeningKind::Window ? WINDOW_EXCHANGE_VELOCITY : PASSAGE_EXCHANGE_VELOCITY;
+    float factor = m_face == RoomFace::Ceiling ? CEILING_EXCHANGE_FACTOR : m_face == RoomFace::Floor ? FLOOR_EXCHANGE_FACTOR : 1.f;
+    return area(width, depth, height) * velocity * factor;
+}
+
+float ScenarioOpening::source(float width, float depth, float height) const {
+    float concentration = m_kind == OpeningKind::Window ? WINDOW_INFLOW_CONCENTRATION : PASSAGE_INFLOW_CONCENTRATION;
+    return flow(width, depth, height) * concentration;
+}
+
+Vec3D ScenarioOpening::facePoint(RoomFace face, float u, float v) {
+    Vec3D p{0.f, 0.f, 0.f};
+    axisValue(p, normalAxis(face)) = positiveSide(face) ? 0.5f : -0.5f;
+    axisValue(p, uAxis(face)) = u;
+    axisValue(p, vAxis(face)) = v;
+    return p;
+}
+
+bool ScenarioOpening::findFace(const std::array<Vec3D, 4>& corners, RoomFace& face) {
+    for (int axis = 0; axis < 3; ++axis) {
+        for (bool positive : {false, true}) {
+            float side = positive ? 0.5f : -0.5f;
+            bool onFace = true;
+            for (const Vec3D& c : corners) onFace = onFace && std::fabs(axisValue(c, axis) - side) <= FACE_TOLERANCE;
+            if (onFace) { face = faceOf(axis, positive); return true; }
+        }
+    }
+    return false;
+}
+
+FacePlacement ScenarioOpening::clampToFace(const FacePlacement& placement) {
+    FacePlacement p = placement;
+    p.halfU = std::clamp(p.halfU, MIN_HALF_SIZE, 0.5f);
+    p.halfV = std::clamp(p.halfV, MIN_HALF_SIZE, 0.5f);
+    p.u = std::clamp(p.u, p.halfU - 0.5f, 0.5f - p.halfU);
+    p.v = std::clamp(p.v, p.halfV - 0.5f, 0.5f - p.halfV);
+    return p;
+}
+
+// 3D 중심과 축별 반폭으로 옮긴 뒤, 면 밖으로 나간 축이 있으면 그 축 방향 면으로 접어 넘김
+// (넘어간 축의 반폭은 원래 법선 축 방향 반폭이 되고, 중심은 모서리에서 그만큼 안쪽, 한 번에 한 면만 넘어감)
+FacePlacement ScenarioOpening::slide(const FacePlacement& placement, float du, float dv) {
+    RoomFace face = placement.face;
+    int n = normalAxis(face), a = uAxis(face), b = vAxis(face);
+    Vec3D center{0.f, 0.f, 0.f}, half{0.f, 0.f, 0.f};
+    axisValue(center, n) = positiveSide(face) ? 0.5f : -0.5f;
+    axisValue(center, a) = placement.u + du;
+    axisValue(center, b) = placement.v + dv;
+    axisValue(half, a) = placement.halfU;
+    axisValue(half, b) = placement.halfV;
+    for (int axis : {a, b}) {
+        float value = axisValue(center, axis);
+        if (std::fabs(value) <= 0.5f) continue;
+        bool positive = value > 0.f;
+        axisValue(center, n) -= (positiveSide(face) ? 1.f : -1.f) * axisValue(half, axis);
+        axisValue(half, n) = axisValue(half, axis);
+        axisValue(center, axis) = positive ? 0.5f : -0.5f;
+        axisValue(half, axis) = 0.f;
+        face = faceOf(axis, positive);
+        break;
+    }
+    return {face, axisValue(center, uAxis(face)), axisValue(center, vAxis(face)), axisValue(half, uAxis(face)), axisValue(half, vAxis(face))};
+}
+
+int Scenario::count(OpeningKind kind) const {
+    int n = 0;
+    for (const auto& o : openings) if (o.kind() == kind) ++n;
+    return n;
+}
+
+RoomConfig Scenario::roomConfig() const {
+    return {width, depth, height, pollutantIndex, count(OpeningKind::Passage), count(OpeningKind::Window)};
+}
+
+float Scenario::volume() const {
+    float boxVolume = ConcentrationModel::roomVolume(roomConfig());
+    return mesh ? boxVolume * mesh->fillFraction() : boxVolume;
+}
+
+float Scenario::exchangeFlow() const {
+    float total = 0.f;
+    for (const auto& o : openings) total += o.flow(width, depth, height);
+    return total;
+}
+
+bool Scenario::defaultSK(float& S, float& K) const {
+    bool known = ConcentrationModel::defaultSK(pollutantIndex, 0, 0, S, K);
+    float roomVolume = volume();
+    for (const auto& o : openings) {
+        S += o.source(width, depth, height);
+        K += o.flow(width, depth, height) / roomVolume;
+    }
+    return known;
+}
+
+std::vector<FieldOpening> Scenario::fieldOpenings() const {
+    std::vector<FieldOpening> result;
+    for (const auto& o : openings) if (o.kind() == OpeningKind::Window) result.push_back({o.corners(), o.flow(width, depth, height)});
+    for (const auto& o : openings) if (o.kind() == OpeningKind::Passage) result.push_back({o.corners(), o.flow(width, depth, height)});
+    return result;
+}
+
+bool Scenario::saveToFile(const std::string& filename) const {
+    std::ofstream outFile(filename);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Could not open file to save scenario: " << filename << std::endl;
+        return false;
+    }
+    outFile.precision(std::numeric_limits<float>::max_digits10); // float 값을 그대로 되살릴 수 있는 자릿수
+    outFile << MAGIC << ' ' << (mesh ? FORMAT_VERSION : 1) << '\n'; // 메시가 없으면 이전 버전도 읽을 수 있게 버전 1
+    outFile << "room " << width << ' ' << depth << ' ' << height << '\n';
+    outFile << "pollutant " << pollutantIndex << '\n';
+    for (const auto& o : openings) {
+        outFile << (o.kind() == OpeningKind::Passage ? "passage" : "window");
+        for (const Vec3D& c : o.corners()) outFile << ' ' << c.x << ' ' << c.y << ' ' << c.z;
+        outFile << '\n';
+    }
+    if (mesh) {
+        // 시나리오 파일 위치 기준 상대 경로 (구할 수 없으면 절대 경로)
+        std::error_code error;
+        std::filesystem::path base = std::filesystem::absolute(filename, error).parent_path();
+        std::filesystem::path meshPath = std::filesystem::absolute(mesh->filename(), error);
+        std::filesystem::path relative = meshPath.lexically_relative(base);
+        outFile << "mesh " << (relative.empty() ? meshPath : relative).generic_string() << '\n';
+    }
+    if (!outFile) {
+        std::cerr << "Error: Could not write scenario file: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// 정규화 로컬 좌표 범위 안의 유한한 값인지
+static bool validCorner(const Vec3D& c) {
+    const float LIMIT = 0.5f + 1e-4f; // 저장/계산 반올림 여유
+    return std::isfinite(c.x) && std::isfinite(c.y) && std::isfinite(c.z) &&
+           std::fabs(c.x) <= LIMIT && std::fabs(c.y) <= LIMIT && std::fabs(c.z) <= LIMIT;
+}
+
+// 모든 줄을 임시 객체에 읽은 뒤 오류가 없을 때만 반영
+bool Scenario::loadFromFile(const std::string& filename) {
+    std::ifstream inFile(filename);
+    if (!inFile.is_open()) {
+        std::cerr << "Error: Could not open scenario file: " << filename << std::endl;
+        return false;
+    }
+    Scenario loaded;
+    std::string line; int lineNo = 0;
+    bool headerSeen = false;
+    int version = 0; // 파일 머리글의 형식 버전
+    while (std::getline(inFile, line)) {
+        ++lineNo;
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream ss(line);
+        std::string key;
+        ss >> key;
+        if (!headerSeen) {
+            if (key != MAGIC || !(ss >> version) || version < 1) {
+                std::cerr << "Error: Not a scenario file: " << filename << std::endl;
+                return false;
+            }
+            if (version > FORMAT_VERSION) {
+                std::cerr << "Error: Scenario file version " << version << " is newer than supported version "
+                          << FORMAT_VERSION << ": " << filename << std::endl;
+                return false;
+            }
+            headerSeen = true;
+            continue;
+        }
+        bool ok = true;
+        if (key == "room") {
+            ok = static_cast<bool>(ss >> loaded.width >> loaded.depth >> loaded.height) &&
+                 std::isfinite(loaded.width) && std::isfinite(loaded.depth) && std::isfinite(loaded.height) &&
+                 loaded.width > 0.f && loaded.depth > 0.f && loaded.height > 0.f;
+        } else if (key == "pollutant") {
+            ok = static_cast<bool>(ss >> loaded.pollutantIndex) && loaded.pollutantIndex >= 0 && loaded.pollutantIndex <= 2;
+        } else if (key == "passage" || key == "window") {
+            std::array<Vec3D, 4> corners{};
+            for (Vec3D& c : corners) {
+                ok = ok && static_cast<bool>(ss >> c.x >> c.y >> c.z) && validCorner(c);
+            }
+            RoomFace face;
+            ok = ok && ScenarioOpening::findFace(corners, face);
+            if (ok) loaded.openings.emplace_back(key == "passage" ? OpeningKind::Passage : OpeningKind::Window, corners);
+        } else if (key == "mesh" && version < 2) { // mesh 줄은 버전 2부터
+            std::cerr << "Error: Mesh entry requires scenario version 2 on line " << lineNo << ": " << line << std::endl;
+            return false;
+        } else if (key == "mesh") {
+            std::string path;
+            std::getline(ss >> std::ws, path);
+            while (!path.empty() && (path.back() == '\r' || path.back() == ' ')) path.pop_back();
+            std::filesystem::path meshPath(path);
+            if (meshPath.is_relative()) meshPath = std::filesystem::path(filename).parent_path() / meshPath;
+            auto roomMesh = std::make_shared<RoomMesh>();
+            ok = !path.empty() && roomMesh->loadFromFile(meshPath.string());
+            if (ok) loaded.mesh = std::move(roomMesh);
+        } else {
+            std::cerr << "Warning: Skipping unknown line " << lineNo << ": " << line << std::endl;
+            continue;
+        }
+        std::string extra;
+        if (!ok || (ss >> extra)) {
+            std::cerr << "Error: Invalid scenario entry on line " << lineNo << ": " << line << std::endl;
+            return false;
+        }
+    }
+    if (!headerSeen) {
+        std::cerr << "Error: Not a scenario file: " << filename << std::endl;
+        return false;
+    }
+    *this = std::move(loaded);
+    return true;
+}
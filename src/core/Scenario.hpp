@@ -0,0 +1,121 @@
+#ifndef SCENARIO_HPP
+#define SCENARIO_HPP
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Geometry.hpp"
+#include "Model.hpp"
+#include "ConcentrationField.hpp"
+#include "RoomMesh.hpp"
+
+// 개구부 종류
+enum class OpeningKind { Passage, Window };
+
+// 방의 여섯 면 (정규화 로컬 좌표, 화면 아래쪽이 +y이므로 y = +0.5가 바닥)
+// 순서는 법선 축(x, y, z)별로 음/양 방향: 인덱스 / 2가 축, 인덱스 % 2가 양의 방향인지
+enum class RoomFace { Left, Right, Ceiling, Floor, Front, Back };
+
+// 면 위 사각형의 위치와 크기 (정규화 로컬 좌표)
+// 벽면은 u가 수평 축(x 또는 z), v가 높이 축(y), 천장/바닥은 u = x, v = z
+struct FacePlacement {
+    RoomFace face;
+    float u, v;         // 사각형 중심
+    float halfU, halfV; // 사각형 반폭
+};
+
+// 개구부 하나: 종류와 면 위 사각형 네 꼭짓점 (정규화 로컬 좌표, 한 축은 ±0.5인 면)
+// 놓인 면과 정규화 넓이(면의 두 변을 1로 본 넓이)는 꼭짓점이 바뀔 때 한 번만 계산해 두므로
+// 실제 넓이와 풍량은 방 크기 곱셈 몇 번으로 다시 구함 (개구부를 끌어 옮기는 동안 매번 재평가해도 가벼움)
+class ScenarioOpening {
+public:
+    // 꼭짓점으로 생성 (어느 면에도 정확히 놓이지 않으면 가장 가까운 면 기준으로 넓이 계산)
+    ScenarioOpening(OpeningKind kind, const std::array<Vec3D, 4>& corners);
+    // 면 위 위치/크기로 생성
+    ScenarioOpening(OpeningKind kind, const FacePlacement& placement);
+
+    OpeningKind kind() const;
+    const std::array<Vec3D, 4>& corners() const;
+    RoomFace face() const;
+    // 꼭짓점의 경계 사각형으로 본 면 위 위치/크기
+    FacePlacement placement() const;
+    // 꼭짓점 교체 / 면 위 위치/크기로 다시 배치 (캐시 갱신)
+    void setCorners(const std::array<Vec3D, 4>& corners);
+    void place(const FacePlacement& placement);
+
+    // 방 크기(m)에서의 실제 넓이 (m²)
+    float area(float width, float depth, float height) const;
+    // 환기 풍량 (m³/min) = 넓이 × 종류별 교환 풍속 × 면 방향 배율
+    float flow(float width, float depth, float height) const;
+    // 개구부로 들어오는 오염물질 유입 속도 (S 증가량) = 풍량 × 종류별 유입 공기 농도
+    float source(float width, float depth, float height) const;
+
+    // 면 좌표 (u, v)의 로컬 정규화 좌표
+    static Vec3D facePoint(RoomFace face, float u, float v);
+    // 네 꼭짓점이 모두 한 면 위에 있으면 그 면을 face에 넣고 true
+    static bool findFace(const std::array<Vec3D, 4>& corners, RoomFace& face);
+    // 면 안에 들어오도록 크기(최소 MIN_HALF_SIZE)와 중심 보정
+    static FacePlacement clampToFace(const FacePlacement& placement);
+    // 면을 따라 (du, dv)만큼 이동, 중심이 모서리를 넘으면 모서리를 접어 옆 면으로 넘어감
+    // 결과는 면 안으로 보정하지 않으므로 끌기 중에는 이 값을 누적하고 배치할 때 clampToFace() 적용
+    static FacePlacement slide(const FacePlacement& placement, float du, float dv);
+
+    // 넓이 1 m²당 교환 풍량 (m/min), 기본 크기 개구부가 기본 방(5 x 5 x 3 m)에서 종전 개수별 K 조정량과 같아지도록 맞춤
+    static const float WINDOW_EXCHANGE_VELOCITY;  // 기본 창문 3 m² → 3.75 m³/min (K +0.05)
+    static const float PASSAGE_EXCHANGE_VELOCITY; // 기본 통로 2.625 m² → 1.5 m³/min (K +0.02)
+    // 유입 공기의 오염물질 농도 (같은 기준으로 종전 개수별 S 조정량에 맞춤)
+    static const float WINDOW_INFLOW_CONCENTRATION;  // 3.75 m³/min → S +3
+    static const float PASSAGE_INFLOW_CONCENTRATION; // 1.5 m³/min → S +5
+    // 면 방향별 풍량 배율 (벽면 1, 천장은 데워진 공기가 위로 빠져나가 크고 바닥은 작음)
+    static const float CEILING_EXCHANGE_FACTOR;
+    static const float FLOOR_EXCHANGE_FACTOR;
+    static const float MIN_HALF_SIZE; // 개구부 최소 반폭 (정규화 좌표)
+
+private:
+    OpeningKind m_kind;
+    std::array<Vec3D, 4> m_corners;
+    RoomFace m_face;  // 캐시: 놓인 면
+    float m_faceArea; // 캐시: 정규화 넓이
+
+    void updateGeometry(); // 면과 정규화 넓이 다시 계산
+};
+
+// 설정 화면에서 만든 시뮬레이션 구성 (방 크기, 오염물질, 개구부 형상) (SFML 비의존 코어)
+// 화면 전환 시에는 값 그대로 넘기고, 파일은 사용자가 명시적으로 저장/불러오기할 때만 사용
+// 파일 형식 (텍스트, 한 줄에 항목 하나, '#'으로 시작하는 줄은 주석):
+//   iaps-scenario <버전>
+//   room <너비> <깊이> <높이>
+//   pollutant <인덱스>
+//   passage|window x0 y0 z0 x1 y1 z1 x2 y2 z2 x3 y3 z3   (개구부마다 한 줄, 추가한 순서, 네 꼭짓점은 한 면 위)
+//   mesh <경로>   (버전 2, 다면체 방을 쓸 때만, 줄 끝까지가 경로이며 상대 경로는 시나리오 파일 기준)
+// 실수는 float을 정확히 되살릴 수 있는 자릿수로 저장하므로 저장 → 불러오기 후 값이 같음
+struct Scenario {
+    float width = 5.f, depth = 5.f, height = 3.f; // 방 크기 (m, GUI 기본값)
+    int pollutantIndex = 0;                       // 오염물질 인덱스 (0: PM10, 1: CO, 2: Cl2)
+    std::vector<ScenarioOpening> openings;        // 개구부 목록 (추가한 순서)
+    std::shared_ptr<const RoomMesh> mesh;         // 다면체 방 (없으면 직육면체, 경계 상자가 방 크기에 맞춰 늘어남)
+
+    // 종류별 개구부 수
+    int count(OpeningKind kind) const;
+    // 개구부 수를 포함한 완전 혼합 모델용 방 설정
+    RoomConfig roomConfig() const;
+    // 방 부피 (m³, 다면체 방이면 채움 비율 × 방 크기 부피)
+    float volume() const;
+    // 개구부 전체 환기 풍량 (m³/min)
+    float exchangeFlow() const;
+    // 오염물질 기본값(밀폐 상태)에 개구부별 유입량과 풍량/부피를 더한 S, K (알 수 없는 오염물질이면 PM10 기본값, 반환값 false)
+    bool defaultSK(float& S, float& K) const;
+    // 농도장 경계 (창문을 먼저 넣어 첫 번째 창문이 외부 공기 유입구, 풍량은 개구부 형상으로 계산)
+    std::vector<FieldOpening> fieldOpenings() const;
+
+    // 파일로 저장 (실패하면 false)
+    bool saveToFile(const std::string& filename) const;
+    // 파일에서 불러오기 (형식 오류나 지원하지 않는 버전, 메시를 불러오지 못하면 false, 이때 현재 값은 바뀌지 않음)
+    bool loadFromFile(const std::string& filename);
+
+    static const int FORMAT_VERSION;       // 지원하는 최신 파일 형식 버전 (이보다 새 버전 파일은 거부, 메시가 없으면 버전 1로 저장)
+    static const char* const DEFAULT_FILE; // GUI 저장/불러오기 경로
+};
+
+#endif
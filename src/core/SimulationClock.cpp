@@ -0,0 +1,35 @@
+#include "SimulationClock.hpp"
+#include <algorithm>
+
+const double SimulationClock::MIN_SPEED = 1.0;
+const double SimulationClock::MAX_SPEED = 100000.0;
+const double SimulationClock::DEFAULT_SPEED = 60.0;
+const double SimulationClock::STEP_MINUTES = 1.0;
+
+SimulationClock::SimulationClock() : m_time(0.0), m_speed(DEFAULT_SPEED), m_paused(true) {}
+
+void SimulationClock::setSpeed(double speed) { m_speed = std::clamp(speed, MIN_SPEED, MAX_SPEED); }
+double SimulationClock::speed() const { return m_speed; }
+
+void SimulationClock::setPaused(bool paused) { m_paused = paused; }
+bool SimulationClock::paused() const { return m_paused; }
+
+double SimulationClock::advance(double realSeconds) {
+    if (m_paused || realSeconds <= 0.0) return 0.0;
+    double minutes = realSeconds * m_speed / 60.0; // 실제 초 → 분, 배속 적용
+    m_time += minutes;
+    return minutes;
+}
+
+void SimulationClock::step(double minutes) {
+    if (minutes > 0.0) m_time += minutes;
+}
+
+void SimulationClock::seek(double minutes) { m_time = std::max(minutes, 0.0); }
+
+void SimulationClock::reset() {
+    m_time = 0.0;
+    m_paused = true;
+}
+
+double SimulationClock::time() const { return m_time; }
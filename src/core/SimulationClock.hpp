@@ -0,0 +1,42 @@
+#ifndef SIMULATION_CLOCK_HPP
+#define SIMULATION_CLOCK_HPP
+
+// 실제 경과 시간과 분리된 시뮬레이션 시계 (SFML 비의존 코어)
+// 배속은 실시간 대비 배수 (1배 = 실제 1분에 시뮬레이션 1분, 60배 = 실제 1초에 1분)
+// 시간은 분 단위 double로 누적해 1분 미만 해상도를 유지하고, 24시간(1440분) 이상 진행해도 오차가 쌓이지 않음
+// 완전 혼합 모델은 해석해가 있으므로 seek()로 임의 시간으로 바로 이동할 수 있음 (단계 적분 없음)
+class SimulationClock {
+public:
+    SimulationClock();
+
+    // 배속 설정 (MIN_SPEED ~ MAX_SPEED로 제한)
+    void setSpeed(double speed);
+    double speed() const;
+
+    // 일시 정지/재개 (정지 중에는 advance()가 시간을 진행하지 않음)
+    void setPaused(bool paused);
+    bool paused() const;
+
+    // 실제 경과 시간(초)만큼 배속을 곱해 진행하고, 진행한 시뮬레이션 시간(분) 반환
+    double advance(double realSeconds);
+    // 일시 정지 여부와 관계없이 지정한 시뮬레이션 시간(분)만큼 진행
+    void step(double minutes);
+    // 시뮬레이션 시간 t(분)로 바로 이동 (음수는 0으로 보정)
+    void seek(double minutes);
+    // 시간 0, 정지 상태로 초기화 (배속은 유지)
+    void reset();
+
+    double time() const; // 현재 시뮬레이션 시간 (분)
+
+    static const double MIN_SPEED;     // 최소 배속 (실시간)
+    static const double MAX_SPEED;     // 최대 배속
+    static const double DEFAULT_SPEED; // 기본 배속 (실제 1초 = 시뮬레이션 1분)
+    static const double STEP_MINUTES;  // 한 단계 진행 시 기본 시간 (분)
+
+private:
+    double m_time;  // 시뮬레이션 시간 (분)
+    double m_speed; // 실시간 대비 배속
+    bool m_paused;
+};
+
+#endif
@@ -0,0 +1,301 @@
+#include "SimulationWorker.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+const std::size_t SimulationWorker::DEFAULT_MAX_PARTICLES = 500;
+const float SimulationWorker::TICK_INTERVAL = 1.f / 60.f; // 화면 갱신과 같은 주기
+const float SimulationWorker::MAX_TICK = 0.25f;
+const int SimulationWorker::MAX_FIELD_STEPS_PER_TICK = 64;
+const double SimulationWorker::PARTICLE_SECONDS_PER_MINUTE = 1.0; // 기본 배속(60배)에서 실제 시간과 같은 속도로 움직임
+const float SimulationWorker::MAX_MESH_OVERSAMPLE = 8.f; // 경계 상자의 1/8보다 작은 방에서는 표시 개수가 줄어듦
+
+SimulationWorker::SimulationWorker(std::size_t maxParticles)
+    : m_roomWidth(1.f), m_roomDepth(1.f), m_roomHeight(1.f), m_resolution(ConcentrationField::DEFAULT_RESOLUTION),
+      m_maxParticles(maxParticles), m_epoch(std::chrono::steady_clock::now()), m_params{0.f, 0.f, ConcentrationModel::MIN_K, 1.f},
+      m_concentration(0.f), m_commandsApplied(0), m_recordSeries(0), m_commandsPosted(0), m_stop(false) {
+    m_field.setThreadPool(&m_pool);     // 격자 구성 전에 지정해 배열도 작업자들이 첫 접근
+    m_particles.setThreadPool(&m_pool);
+    m_thread = std::thread(&SimulationWorker::run, this);
+}
+
+SimulationWorker::~SimulationWorker() {
+    {
+        std::lock_guard<std::mutex> lock(m_commandMutex);
+        m_stop = true;
+    }
+    m_commandAvailable.notify_one();
+    m_thread.join();
+}
+
+void SimulationWorker::post(std::function<void()> command) {
+    {
+        std::lock_guard<std::mutex> lock(m_commandMutex);
+        m_commands.push_back(std::move(command));
+        m_commandsPosted.fetch_add(1, std::memory_order_release);
+    }
+    m_commandAvailable.notify_one();
+}
+
+void SimulationWorker::configure(float width, float depth, float height, float volume, const std::vector<FieldOpening>& openings) {
+    post([this, width, depth, height, volume, openings] {
+        m_roomWidth = width; m_roomDepth = depth; m_roomHeight = height;
+        m_openings = openings;
+        m_params.V = volume;
+        configureField();
+    });
+}
+
+void SimulationWorker::configureField() {
+    m_field.configure(m_roomWidth, m_roomDepth, m_roomHeight, m_resolution, m_openings);
+    m_field.setParameters(m_params.S, ConcentrationField::bulkDecay(m_params.K, m_params.V, m_openings));
+    m_field.reset(m_concentration);
+}
+
+void SimulationWorker::setRoomMesh(std::shared_ptr<const RoomMesh> mesh) {
+    post([this, mesh] { m_mesh = mesh; });
+}
+
+void SimulationWorker::setParameters(float S, float K) {
+    post([this, S, K] {
+        m_params.S = S;
+        m_params.K = K;
+        // K 또는 V가 0에 매우 가까운데 S가 0이 아니면 이론상 농도는 발산
+        if (m_params.K * m_params.V <= 1e-9 && m_params.S != 0.0f) {
+            std::cerr << "Warning: K*V is near zero while S is not. Concentration might be unstable." << std::endl;
+        }
+        m_field.setParameters(S, ConcentrationField::bulkDecay(K, m_params.V, m_openings));
+    });
+}
+
+void SimulationWorker::setInitialConcentration(float C0) {
+    post([this, C0] {
+        m_params.C0 = C0;
+        m_concentration = C0;
+        m_field.reset(C0);
+    });
+}
+
+void SimulationWorker::setRunning(bool running) {
+    post([this, running] {
+        m_clock.setPaused(!running);
+        if (running) updateConcentration(); // 시간 0에서 실행하면 C(0) = C0, 재개하면 현재 시간의 농도
+    });
+}
+
+void SimulationWorker::setSpeed(double speed) {
+    post([this, speed] { m_clock.setSpeed(speed); });
+}
+
+void SimulationWorker::step(double minutes) {
+    post([this, minutes] {
+        m_clock.step(minutes);
+        advanceField(minutes);
+        updateConcentration();
+    });
+}
+
+void SimulationWorker::seek(double minutes) {
+    post([this, minutes] {
+        m_clock.seek(minutes);
+        updateConcentration();
+        m_field.reset(m_concentration); // 농도장은 해석해가 없으므로 이동한 시간의 완전 혼합 농도에서 다시 시작
+        m_population.snap(static_cast<std::size_t>(targetParticleCount())); // 탐색 중에는 곡선 없이 그 시간의 개수
+        ++m_recordSeries; // 시간이 이어지지 않으므로 새 계열
+    });
+}
+
+void SimulationWorker::reset(float C0) {
+    post([this, C0] {
+        m_clock.reset();
+        m_params.C0 = C0;
+        m_concentration = C0;
+        m_field.reset(C0);
+        m_population.snap(static_cast<std::size_t>(targetParticleCount()));
+        ++m_recordSeries;
+    });
+}
+
+void SimulationWorker::setMaxParticles(std::size_t maxParticles) {
+    post([this, maxParticles] { m_maxParticles = maxParticles; });
+}
+
+void SimulationWorker::setFieldResolution(int resolution) {
+    post([this, resolution] {
+        if (resolution == m_resolution) return;
+        m_resolution = resolution;
+        configureField(); // 해상도가 다른 격자 사이에는 분포를 옮기지 않고 현재 완전 혼합 농도에서 다시 시작
+    });
+}
+
+void SimulationWorker::setPopulationRamp(PopulationRamp::Curve curve, double seconds) {
+    post([this, curve, seconds] { m_population.setCurve(curve, seconds); });
+}
+
+void SimulationWorker::startRecording(const std::string& filename) {
+    post([this, filename] {
+        m_recordSeries = 0;
+        m_recorder.start(filename, TimeSeriesRecorder::formatFor(filename)); // 실패하면 snapshot().recording이 false로 남음
+    });
+}
+
+void SimulationWorker::stopRecording() {
+    post([this] { // 생산자(작업 스레드)에서 멈춰야 마지막 표본까지 쓰기 스레드에 보임
+        if (!m_recorder.recording()) return;
+        m_recorder.stop();
+        std::cout << "Recording saved to " << m_recorder.filename() << " (" << m_recorder.writtenCount()
+                  << " samples, " << m_recorder.droppedCount() << " dropped)" << std::endl;
+    });
+}
+
+bool SimulationWorker::poll() { return m_snapshots.update(); }
+const SimulationSnapshot& SimulationWorker::snapshot() const { return m_snapshots.readBuffer(); }
+std::uint64_t SimulationWorker::commandsPosted() const { return m_commandsPosted.load(std::memory_order_acquire); }
+
+bool SimulationWorker::isAnimating() const { return !m_clock.paused() || m_population.active(elapsedSeconds()); }
+
+double SimulationWorker::elapsedSeconds() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+// 작업 스레드 본체: 명령 적용 → 한 틱 진행 → 상태 전달을 TICK_INTERVAL마다 반복
+// (틱이 TICK_INTERVAL보다 오래 걸리면 쉬지 않고 다음 틱 진행, 진행 시간은 실제 경과 시간을 따름)
+void SimulationWorker::run() {
+    using Clock = std::chrono::steady_clock;
+    const auto tickInterval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(TICK_INTERVAL));
+    auto lastTick = Clock::now();
+    std::vector<std::function<void()>> commands;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_commandMutex);
+            if (!isAnimating()) { // 바뀔 것이 없으면 다음 명령까지 잠듦 (잠든 시간은 진행 시간에 넣지 않음)
+                m_commandAvailable.wait(lock, [this] { return m_stop || !m_commands.empty(); });
+                lastTick = Clock::now();
+            }
+            if (m_stop) return;
+            commands.swap(m_commands);
+        }
+        m_tickStart = Clock::now();
+        if (!commands.empty()) {
+            PROFILE_SCOPE("worker", "commands");
+            for (auto& command : commands) command();
+            m_commandsApplied += commands.size();
+            commands.clear();
+        }
+
+        auto now = Clock::now();
+        float dt = std::min(std::chrono::duration<float>(now - lastTick).count(), MAX_TICK); // 실제 경과 시간 (초)
+        lastTick = now;
+        tick(dt);
+        publish();
+
+        // 다음 틱까지 대기 (명령이 오면 바로 깨어나 반영)
+        std::unique_lock<std::mutex> lock(m_commandMutex);
+        m_commandAvailable.wait_until(lock, now + tickInterval, [this] { return m_stop || !m_commands.empty(); });
+    }
+}
+
+// 시계가 배속만큼 진행한 시뮬레이션 시간으로 농도장을 적분하고 완전 혼합 농도는 매 틱 해석해로 계산
+// (파티클은 publish()에서 시간으로부터 바로 계산하므로 따로 적분하지 않음)
+void SimulationWorker::tick(float dt) {
+    PROFILE_SCOPE("worker", "tick");
+    double minutes = m_clock.advance(dt);
+    if (minutes > 0.0) {
+        advanceField(minutes);
+        updateConcentration();
+    }
+}
+
+// 농도장 적분 비용은 진행 시간에 비례하므로 틱당 MAX_FIELD_STEPS_PER_TICK 단계까지만 적분
+// (높은 배속에서는 농도장이 시계보다 늦게 진행하지만 정상 상태로 수렴하는 분포 모양은 유지, C(t)는 항상 정확)
+void SimulationWorker::advanceField(double minutes) {
+    double budget = static_cast<double>(m_field.stableStep()) * MAX_FIELD_STEPS_PER_TICK;
+    m_field.advance(static_cast<float>(std::min(minutes, budget)));
+}
+
+void SimulationWorker::updateConcentration() {
+    m_concentration = ConcentrationModel::concentrationAt(m_params, static_cast<float>(m_clock.time()));
+}
+
+// 목표 파티클 수 = 최대 파티클 수 × (현재 농도 / 기준 농도), 기준 농도는 C0(최소 1)와 현재 농도 중 큰 값
+int SimulationWorker::targetParticleCount() const {
+    float reference = std::max(std::max(m_params.C0, 1.0f), m_concentration);
+    int count = static_cast<int>(static_cast<float>(m_maxParticles) * (m_concentration / reference));
+    return std::clamp(count, 0, static_cast<int>(m_maxParticles));
+}
+
+// 뒤 버퍼를 현재 상태로 채워 넘김 (버퍼 배열은 최대 파티클 수 크기로 한 번 할당한 풀이라 파티클 수가 바뀌어도 할당 없음)
+// 목표 개수가 바뀌면 곡선만 다시 시작하고, 표시 개수는 곡선의 현재 값 (생성/소멸은 개수 변경뿐이라 변화량과 무관)
+// 파티클 구름은 현재 시간에서 한 번에 다시 계산하고, 위치의 국소 농도 / 최대 농도로 투명도를 낮춰 농도장 분포를 보여 줌
+void SimulationWorker::publish() {
+    PROFILE_SCOPE("worker", "publish");
+    SimulationSnapshot& snapshot = m_snapshots.writeBuffer();
+    snapshot.time = m_clock.time();
+    snapshot.concentration = m_concentration;
+    snapshot.peak = m_field.maxValue();
+    snapshot.commandsApplied = m_commandsApplied;
+    if (snapshot.x.size() != m_maxParticles) {
+        snapshot.x.assign(m_maxParticles, 0.f); snapshot.y.assign(m_maxParticles, 0.f);
+        snapshot.z.assign(m_maxParticles, 0.f); snapshot.alpha.assign(m_maxParticles, 0.f);
+    }
+    double now = elapsedSeconds();
+    m_population.retarget(static_cast<std::size_t>(targetParticleCount()), now);
+    std::size_t n = std::min(m_population.value(now), m_maxParticles);
+    snapshot.settled = !isAnimating();
+    float* x = snapshot.x.data();
+    float* y = snapshot.y.data();
+    float* z = snapshot.z.data();
+    float* alpha = snapshot.alpha.data();
+    {
+        PROFILE_SCOPE("worker", "particles.evaluate");
+        double t = m_clock.time() * PARTICLE_SECONDS_PER_MINUTE;
+        if (m_mesh) n = evaluateInsideMesh(t, n, x, y, z, alpha);
+        else m_particles.evaluate(t, n, x, y, z, alpha);
+    }
+    snapshot.particleCount = n;
+    if (m_recorder.recording()) {
+        m_recorder.record({m_clock.time(), m_concentration, m_params.S, m_params.K, static_cast<std::uint32_t>(n), m_recordSeries});
+    }
+    snapshot.recording = m_recorder.recording();
+    snapshot.recordedSamples = m_recorder.writtenCount();
+    float peak = snapshot.peak;
+    if (peak > 0.f) {
+        PROFILE_SCOPE("worker", "particles.shade");
+        auto shade = [this, peak, x, y, z, alpha](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                float local = m_field.sample({x[i], y[i], z[i]});
+                alpha[i] *= std::clamp(local / peak, 0.f, 1.f);
+            }
+        };
+        if (m_pool.size() > 1 && n > ParticleCloud::PARALLEL_GRAIN) {
+            std::size_t grain = std::max(ParticleCloud::PARALLEL_GRAIN, (n + m_pool.size() - 1) / m_pool.size());
+            m_pool.parallelFor(0, n, grain, shade);
+        } else {
+            shade(0, n);
+        }
+    }
+    snapshot.tickSeconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_tickStart).count();
+    m_snapshots.publish();
+}
+
+// 방 안 비율(마스크 채움 비율)로 나눈 만큼 후보를 계산하고, 안에 있는 것을 번호 순서대로 앞에서부터 n개까지 옮김
+// 파티클 i는 시간의 순수 함수이므로 같은 시간이면 같은 파티클이 남고, 벽을 넘어간 파티클만 다음 후보로 바뀜
+std::size_t SimulationWorker::evaluateInsideMesh(double t, std::size_t n, float* x, float* y, float* z, float* alpha) {
+    if (n == 0) return 0;
+    float fraction = std::max(m_mesh->maskFraction(), 1.f / MAX_MESH_OVERSAMPLE);
+    std::size_t candidates = static_cast<std::size_t>(std::ceil(static_cast<float>(n) / fraction * 1.25f)) + 16; // 분포 흔들림 여유
+    if (m_candidateX.size() < candidates) {
+        m_candidateX.resize(candidates); m_candidateY.resize(candidates);
+        m_candidateZ.resize(candidates); m_candidateAlpha.resize(candidates);
+    }
+    m_particles.evaluate(t, candidates, m_candidateX.data(), m_candidateY.data(), m_candidateZ.data(), m_candidateAlpha.data());
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < candidates && kept < n; ++i) {
+        if (!m_mesh->contains({m_candidateX[i], m_candidateY[i], m_candidateZ[i]})) continue;
+        x[kept] = m_candidateX[i]; y[kept] = m_candidateY[i]; z[kept] = m_candidateZ[i]; alpha[kept] = m_candidateAlpha[i];
+        ++kept;
+    }
+    return kept;
+}
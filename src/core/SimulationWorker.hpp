@@ -0,0 +1,146 @@
+#ifndef SIMULATION_WORKER_HPP
+#define SIMULATION_WORKER_HPP
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include "Model.hpp"
+#include "ConcentrationField.hpp"
+#include "ParticleCloud.hpp"
+#include "RoomMesh.hpp"
+#include "ThreadPool.hpp"
+#include "SimulationClock.hpp"
+#include "PopulationRamp.hpp"
+#include "TripleBuffer.hpp"
+#include "TimeSeriesRecorder.hpp"
+
+// 렌더링 스레드가 읽는 시뮬레이션 상태 한 장 (작업 스레드가 채운 뒤에는 바뀌지 않음)
+struct SimulationSnapshot {
+    double time = 0.0;         // 시뮬레이션 경과 시간 (분, 1분 미만 포함)
+    float concentration = 0.f; // 완전 혼합 모델 농도 C(t)
+    float peak = 0.f;          // 농도장의 국소 최대 농도
+    bool settled = false;      // 실행 중이 아니라 다음 명령 전까지 더 이상 변하지 않음
+    std::uint64_t commandsApplied = 0; // 이 상태를 만들 때까지 적용된 명령 수
+    float tickSeconds = 0.f;   // 이 상태를 만든 틱의 작업 시간 (초, 명령 적용 + 진행 + 파티클 계산)
+    std::size_t particleCount = 0; // 표시할 파티클 수 (배열 앞쪽 particleCount개만 유효)
+    bool recording = false;    // 시계열 기록 중 여부
+    std::uint64_t recordedSamples = 0; // 이번 기록에서 파일에 쓴 표본 수
+    std::vector<float> x, y, z, alpha; // 파티클 위치(정규화 로컬 좌표)와 투명도 (최대 파티클 수 크기로 한 번만 할당, 시간의 순수 함수)
+};
+
+// 농도장 적분과 파티클 계산을 전용 스레드에서 실행하는 시뮬레이션 작업자
+// 화면은 명령(파라미터 변경, 실행/중단, 초기화)을 비동기로 보내고, 작업자는 틱마다 명령을 순서대로 적용한 뒤
+// 한 틱 진행한 결과를 잠금 없는 삼중 버퍼로 넘김. 렌더링은 poll()로 가장 최근 상태만 가져오므로
+// 큰 격자나 많은 파티클로 틱이 길어져도 화면 프레임이 막히지 않고, 느린 프레임이 모델을 막지도 않음
+// 파티클 구름은 시뮬레이션 시간만으로 정해지므로 한 단계 진행, 시간 이동 후에도 이력 없이 바로 다시 만들어짐
+// 파티클 수는 농도를 따라 PopulationRamp 곡선으로 목표 개수에 다가감 (생성/소멸은 개수만 바꾸므로 변화량과 무관하게 O(1))
+// 다면체 방이면 파티클 구름을 넉넉히 계산한 뒤 방 복셀 마스크 안에 있는 것만 남김 (경계 상자 순환 위에 포함 판정 한 번)
+// 기록 중이면 상태를 넘길 때마다 (t, C, S, K, 파티클 수, 계열) 표본을 기록기 큐에 넣기만 하고 파일 쓰기는 기록기 스레드가 맡음
+// 실행 중이 아니고 파티클 수 변화도 끝났으면 작업자는 다음 명령이 올 때까지 잠듦
+class SimulationWorker {
+public:
+    // 생성자: 최대 파티클 수 (작업 스레드 시작)
+    explicit SimulationWorker(std::size_t maxParticles = DEFAULT_MAX_PARTICLES);
+    // 소멸자: 작업 스레드 종료 후 대기
+    ~SimulationWorker();
+
+    SimulationWorker(const SimulationWorker&) = delete;
+    SimulationWorker& operator=(const SimulationWorker&) = delete;
+
+    // --- 명령 (호출 스레드는 기다리지 않음, 작업자가 다음 틱에 보낸 순서대로 적용) ---
+    // 방 크기(m), 부피(m³), 개구부로 농도장 격자 구성
+    void configure(float width, float depth, float height, float volume, const std::vector<FieldOpening>& openings);
+    // 다면체 방 (nullptr이면 직육면체, 파티클은 메시 안에 있는 것만 표시)
+    void setRoomMesh(std::shared_ptr<const RoomMesh> mesh);
+    // 유입 속도 S와 전체 제거 상수 K (개구부 환기분은 농도장 경계에서 처리)
+    void setParameters(float S, float K);
+    // 초기 농도 확정: 현재 농도와 농도장을 C0로 (시간은 유지)
+    void setInitialConcentration(float C0);
+    // 실행/중단 (시간 0에서 실행하면 농도를 C0에서 시작)
+    void setRunning(bool running);
+    // 실시간 대비 배속 (SimulationClock::MIN_SPEED ~ MAX_SPEED)
+    void setSpeed(double speed);
+    // 실행 여부와 관계없이 minutes(분)만큼 진행
+    void step(double minutes);
+    // 시간 t(분)로 바로 이동: 농도는 해석해로 O(1) 계산하고 농도장은 그 농도로 균일하게 다시 시작, 파티클은 t에서 다시 계산
+    void seek(double minutes);
+    // 전체 초기화: 시간 0, 농도장 C0, 파티클 수는 C0에 맞춰 바로 설정, 중단 상태 (배속은 유지)
+    void reset(float C0);
+    // 최대 파티클 수 변경 (상태 배열은 다음 상태부터 이 크기로 다시 할당, 표시 개수는 곡선을 따라 새 목표로)
+    void setMaxParticles(std::size_t maxParticles);
+    // 농도장 격자 해상도 변경 (가장 긴 축 셀 수, 격자를 다시 구성하고 현재 농도에서 다시 시작)
+    void setFieldResolution(int resolution);
+    // 파티클 수가 목표 개수로 다가가는 곡선과 변화 시간(초, 실제 시간)
+    void setPopulationRamp(PopulationRamp::Curve curve, double seconds);
+    // 시계열 기록 시작 (형식은 확장자로, 이미 기록 중이면 이전 파일을 닫고 새로 시작) / 중지 (남은 표본까지 쓰고 닫음)
+    void startRecording(const std::string& filename);
+    void stopRecording();
+
+    // --- 렌더링 스레드 ---
+    // 새 상태가 넘어왔으면 가져오고 true
+    bool poll();
+    // 가장 최근에 가져온 상태
+    const SimulationSnapshot& snapshot() const;
+    // 지금까지 보낸 명령 수 (snapshot().commandsApplied와 다르면 아직 반영되지 않은 명령이 있음)
+    std::uint64_t commandsPosted() const;
+
+    static const std::size_t DEFAULT_MAX_PARTICLES; // 기본 최대 파티클 수
+    static const float TICK_INTERVAL;               // 작업자 틱 간격 (초, 실행 중 목표)
+    static const float MAX_TICK;                    // 한 틱에 진행하는 최대 실제 시간 (초, 긴 정지 후 급격한 점프 방지)
+    static const int MAX_FIELD_STEPS_PER_TICK;      // 한 틱에 적분하는 농도장 최대 내부 단계 수 (높은 배속에서 틱 시간 제한)
+    static const double PARTICLE_SECONDS_PER_MINUTE; // 시뮬레이션 1분당 파티클 애니메이션 시간 (초)
+    static const float MAX_MESH_OVERSAMPLE;         // 다면체 방에서 표시 파티클 하나당 계산하는 최대 후보 수
+
+private:
+    // --- 작업 스레드 전용 상태 ---
+    ThreadPool m_pool;                        // 농도장 타일 적분 및 파티클 갱신용 스레드 풀
+    ConcentrationField m_field;               // 방 내부 3D 농도장
+    std::vector<FieldOpening> m_openings;     // 농도장 경계 개구부
+    float m_roomWidth, m_roomDepth, m_roomHeight; // 방 크기 (m, 해상도를 바꿀 때 다시 구성용)
+    int m_resolution;                         // 농도장 격자 해상도
+    ParticleCloud m_particles;                // 상태 없는 파티클 구름 (시간 → 위치/투명도)
+    std::shared_ptr<const RoomMesh> m_mesh;   // 다면체 방 (없으면 직육면체)
+    std::vector<float> m_candidateX, m_candidateY, m_candidateZ, m_candidateAlpha; // 다면체 방의 파티클 후보 작업 배열
+    std::size_t m_maxParticles;
+    PopulationRamp m_population;              // 표시 파티클 수 (목표 개수로 곡선을 따라 변화)
+    std::chrono::steady_clock::time_point m_epoch; // 파티클 수 곡선의 기준 시각 (작업자 생성 시각)
+    ModelParams m_params;                     // C0, S, K, V
+    SimulationClock m_clock;                  // 시뮬레이션 시간, 배속, 일시 정지 (정지 = 중단 상태)
+    float m_concentration;                    // 현재 농도 C(t) (파티클 수도 이 값을 따름)
+    std::uint64_t m_commandsApplied;          // 적용한 명령 수
+    std::chrono::steady_clock::time_point m_tickStart; // 현재 틱 시작 시각 (틱 작업 시간 측정용)
+    TimeSeriesRecorder m_recorder;            // 시계열 기록기 (작업 스레드가 생산자, 큐가 차면 표본을 버려 틱이 막히지 않음)
+    std::uint32_t m_recordSeries;             // 기록 표본의 계열 번호 (기록 시작 시 0, 초기화/시간 이동으로 시간이 끊길 때마다 증가)
+
+    // --- 스레드 간 공유 ---
+    std::mutex m_commandMutex;                // 명령 큐 보호
+    std::condition_variable m_commandAvailable; // 새 명령 또는 종료 알림
+    std::vector<std::function<void()>> m_commands; // 대기 중인 명령
+    std::atomic<std::uint64_t> m_commandsPosted;  // 보낸 명령 수
+    bool m_stop;                              // 종료 요청 (m_commandMutex로 보호)
+    TripleBuffer<SimulationSnapshot> m_snapshots; // 작업자 → 렌더링 상태 전달
+
+    std::thread m_thread;                     // 작업 스레드 (다른 멤버가 모두 초기화된 뒤 시작하도록 마지막에 선언)
+
+    void post(std::function<void()> command); // 명령 큐에 추가하고 작업자 깨우기
+    void run();                               // 작업 스레드 본체
+    bool isAnimating() const;                 // 다음 틱에도 바뀌는 것이 있는지
+    void tick(float dt);                      // 실제 시간 dt(초)만큼 진행
+    void advanceField(double minutes);        // 농도장을 시뮬레이션 시간(분)만큼 적분 (틱당 단계 수 제한)
+    void updateConcentration();               // 현재 시간의 완전 혼합 농도를 해석해로 계산
+    void configureField();                    // 현재 방 크기, 해상도, 개구부로 농도장 격자 구성
+    int targetParticleCount() const;          // 현재 농도에 해당하는 파티클 수
+    double elapsedSeconds() const;            // 작업자 생성 후 지난 실제 시간 (초, 파티클 수 곡선용)
+    void publish();                           // 현재 상태(파티클 구름 포함)를 삼중 버퍼로 넘김
+    std::size_t evaluateInsideMesh(double t, std::size_t n, float* x, float* y, float* z, float* alpha); // 메시 안 파티클 최대 n개
+};
+
+#endif
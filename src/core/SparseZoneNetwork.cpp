@@ -0,0 +1,288 @@
+#include "SparseZoneNetwork.hpp"
+#include "DenseEigen.hpp"
+#include <cmath>
+#include <algorithm>
+#include <deque>
+#include <utility>
+#include <iostream>
+
+// m = 30이면 τ‖B‖ ≈ 10 정도까지 오차 추정이 허용치 안에 들어옴
+const std::size_t SparseZoneNetwork::KRYLOV_DIM = 30;
+const double SparseZoneNetwork::MAX_STEP_NORM = 10.0;
+const double SparseZoneNetwork::TOLERANCE = 1e-9;
+
+SparseZoneNetwork::SparseZoneNetwork(ThreadPool& pool)
+    : m_pool(pool), m_size(0), m_boundaryZones(0), m_normBound(0.0), m_time(0.0) {}
+
+std::size_t SparseZoneNetwork::size() const { return m_size; }
+
+std::size_t SparseZoneNetwork::numPartitions() const { return m_partitionStart.empty() ? 0 : m_partitionStart.size() - 1; }
+
+std::size_t SparseZoneNetwork::numBoundaryZones() const { return m_boundaryZones; }
+
+double SparseZoneNetwork::time() const { return m_time; }
+
+const std::vector<double>& SparseZoneNetwork::steadyState() const { return m_steadyOriginal; }
+
+template <typename Body>
+void SparseZoneNetwork::forEachPartition(const Body& body) {
+    m_pool.parallelFor(0, numPartitions(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) body(m_partitionStart[p], m_partitionStart[p + 1], p);
+    });
+}
+
+void SparseZoneNetwork::multiply(const double* x, double* y) {
+    forEachPartition([&](std::size_t rowBegin, std::size_t rowEnd, std::size_t) {
+        for (std::size_t i = rowBegin; i < rowEnd; ++i) {
+            double sum = 0.0;
+            for (std::size_t k = m_rowStart[i]; k < m_rowStart[i + 1]; ++k) sum += m_value[k] * x[m_column[k]];
+            y[i] = sum;
+        }
+    });
+}
+
+double SparseZoneNetwork::dot(const double* a, const double* b) {
+    forEachPartition([&](std::size_t rowBegin, std::size_t rowEnd, std::size_t p) {
+        double sum = 0.0;
+        for (std::size_t i = rowBegin; i < rowEnd; ++i) sum += a[i] * b[i];
+        m_partial[p] = sum;
+    });
+    double total = 0.0;
+    for (double v : m_partial) total += v;
+    return total;
+}
+
+bool SparseZoneNetwork::build(const ZoneNetwork& network, std::size_t numPartitions) {
+    const std::vector<ZoneNetwork::Zone>& zones = network.zones();
+    m_size = zones.size();
+    if (m_size == 0) return false;
+
+    // 원래 순서의 인접 목록 (같은 쌍의 연결은 풍량 합산)
+    std::vector<std::vector<std::pair<std::size_t, double>>> adjacency(m_size);
+    std::vector<double> diagonal(m_size);
+    for (std::size_t i = 0; i < m_size; ++i) diagonal[i] = -zones[i].K;
+    for (const ZoneNetwork::Connection& c : network.connections()) {
+        double offDiag = c.flow / std::sqrt(zones[c.a].volume * zones[c.b].volume);
+        adjacency[c.a].push_back({c.b, offDiag});
+        adjacency[c.b].push_back({c.a, offDiag});
+        diagonal[c.a] -= c.flow / zones[c.a].volume; // 유출
+        diagonal[c.b] -= c.flow / zones[c.b].volume;
+    }
+
+    // BFS 순서로 구역을 나열해 같은 크기의 연속 구간으로 분할 (이웃 구역이 같은 분할에 모이도록)
+    if (numPartitions == 0) numPartitions = m_pool.size();
+    numPartitions = std::max<std::size_t>(1, std::min(numPartitions, m_size));
+    m_order.clear(); m_order.reserve(m_size);
+    std::vector<bool> visited(m_size, false);
+    std::deque<std::size_t> queue;
+    for (std::size_t seed = 0; seed < m_size; ++seed) {
+        if (visited[seed]) continue; // 연결되지 않은 부분 그래프마다 새로 시작
+        visited[seed] = true;
+        queue.push_back(seed);
+        while (!queue.empty()) {
+            std::size_t u = queue.front(); queue.pop_front();
+            m_order.push_back(u);
+            for (const auto& edge : adjacency[u]) {
+                if (!visited[edge.first]) { visited[edge.first] = true; queue.push_back(edge.first); }
+            }
+        }
+    }
+    std::vector<std::size_t> position(m_size);
+    for (std::size_t r = 0; r < m_size; ++r) position[m_order[r]] = r;
+    std::size_t target = (m_size + numPartitions - 1) / numPartitions;
+    m_partitionStart.resize(numPartitions + 1);
+    for (std::size_t p = 0; p <= numPartitions; ++p) m_partitionStart[p] = std::min(p * target, m_size);
+    m_partial.assign(numPartitions, 0.0);
+
+    // 재배치 순서의 CSR 행렬 구성 (행마다 열 정렬, 중복 연결 합산)
+    m_rowStart.assign(1, 0);
+    m_column.clear(); m_value.clear();
+    m_sqrtVolume.resize(m_size);
+    m_normBound = 0.0;
+    m_boundaryZones = 0;
+    std::size_t partition = 0;
+    std::vector<std::pair<std::size_t, double>> row;
+    for (std::size_t r = 0; r < m_size; ++r) {
+        while (r >= m_partitionStart[partition + 1]) ++partition;
+        std::size_t old = m_order[r];
+        m_sqrtVolume[r] = std::sqrt(zones[old].volume);
+        row.clear();
+        row.push_back({r, diagonal[old]});
+        bool boundary = false;
+        for (const auto& edge : adjacency[old]) {
+            std::size_t col = position[edge.first];
+            row.push_back({col, edge.second});
+            if (col < m_partitionStart[partition] || col >= m_partitionStart[partition + 1]) boundary = true;
+        }
+        std::sort(row.begin(), row.end());
+        double rowNorm = 0.0;
+        for (std::size_t k = 0; k < row.size(); ++k) {
+            if (k > 0 && row[k].first == row[k - 1].first) { m_value.back() += row[k].second; }
+            else { m_column.push_back(row[k].first); m_value.push_back(row[k].second); }
+            rowNorm += std::fabs(row[k].second);
+        }
+        m_rowStart.push_back(m_column.size());
+        m_normBound = std::max(m_normBound, rowNorm);
+        if (boundary) ++m_boundaryZones;
+    }
+    m_basis.assign((KRYLOV_DIM + 1) * m_size, 0.0);
+
+    // 우변 D b: (D b)_i = √V_i · S_i / V_i = S_i / √V_i
+    std::vector<double> rhs(m_size);
+    for (std::size_t r = 0; r < m_size; ++r) rhs[r] = zones[m_order[r]].S / m_sqrtVolume[r];
+    if (!solveSteadyState(rhs)) {
+        std::cerr << "Warning: Sparse zone network steady state did not fully converge." << std::endl;
+    }
+    m_steadyOriginal.resize(m_size);
+    m_initial.resize(m_size);
+    for (std::size_t r = 0; r < m_size; ++r) {
+        m_steadyOriginal[m_order[r]] = m_steady[r];
+        m_initial[r] = m_sqrtVolume[r] * (zones[m_order[r]].C0 - m_steady[r]);
+    }
+    reset();
+    return true;
+}
+
+// (-B) z = D b, Css = D⁻¹ z  (-B는 K > 0이므로 대칭 양정부호)
+bool SparseZoneNetwork::solveSteadyState(const std::vector<double>& rhs) {
+    const std::size_t n = m_size;
+    const int MAX_ITERATIONS = 10000; // 최대 반복 횟수 (보통 수백 회 이내 수렴)
+    std::vector<double> x(n, 0.0), r(rhs), z(n), p(n), Ap(n), inverseDiagonal(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t k = m_rowStart[i]; k < m_rowStart[i + 1]; ++k) {
+            if (m_column[k] == i) inverseDiagonal[i] = -1.0 / m_value[k];
+        }
+    }
+    bool converged = false;
+    double rhsNorm = std::sqrt(dot(r.data(), r.data()));
+    m_steady.assign(n, 0.0);
+    if (rhsNorm == 0.0) return true; // 오염원 없음: 정상 상태 0
+
+    for (std::size_t i = 0; i < n; ++i) { z[i] = inverseDiagonal[i] * r[i]; p[i] = z[i]; }
+    double rz = dot(r.data(), z.data());
+    for (int iter = 0; iter < MAX_ITERATIONS; ++iter) {
+        multiply(p.data(), Ap.data()); // Ap = B p = -(-B) p
+        double alpha = -rz / dot(p.data(), Ap.data());
+        forEachPartition([&](std::size_t rowBegin, std::size_t rowEnd, std::size_t part) {
+            double sum = 0.0;
+            for (std::size_t i = rowBegin; i < rowEnd; ++i) {
+                x[i] += alpha * p[i];
+                r[i] += alpha * Ap[i];
+                z[i] = inverseDiagonal[i] * r[i];
+                sum += r[i] * r[i];
+            }
+            m_partial[part] = sum;
+        });
+        double residual = 0.0;
+        for (double v : m_partial) residual += v;
+        if (std::sqrt(residual) <= TOLERANCE * rhsNorm) { converged = true; break; }
+        double rzNext = dot(r.data(), z.data());
+        double beta = rzNext / rz;
+        rz = rzNext;
+        forEachPartition([&](std::size_t rowBegin, std::size_t rowEnd, std::size_t) {
+            for (std::size_t i = rowBegin; i < rowEnd; ++i) p[i] = z[i] + beta * p[i];
+        });
+    }
+    for (std::size_t i = 0; i < n; ++i) m_steady[i] = x[i] / m_sqrtVolume[i];
+    return converged;
+}
+
+void SparseZoneNetwork::reset() {
+    m_state = m_initial;
+    m_time = 0.0;
+}
+
+void SparseZoneNetwork::advance(double dt) {
+    if (m_size == 0 || dt <= 0.0) return;
+    double remaining = dt;
+    while (remaining > 0.0) {
+        double tau = krylovStep(remaining);
+        if (tau >= remaining) break;
+        remaining -= tau;
+    }
+    m_time += dt;
+}
+
+// Lanczos: B Q_m = Q_m T_m + β_m q_{m+1} e_mᵀ,  e^{Bτ} y ≈ ‖y‖ Q_m e^{T_m τ} e_1
+// 오차 추정: ‖y‖ β_m |e_mᵀ e^{T_m τ} e_1|
+double SparseZoneNetwork::krylovStep(double dt) {
+    const std::size_t n = m_size;
+    double beta0 = std::sqrt(dot(m_state.data(), m_state.data()));
+    if (beta0 == 0.0) return dt; // 이미 정상 상태
+
+    double* basis = m_basis.data();
+    forEachPartition([&](std::size_t rowBegin, std::size_t rowEnd, std::size_t) {
+        for (std::size_t i = rowBegin; i < rowEnd; ++i) basis[i] = m_state[i] / beta0;
+    });
+    std::vector<double> alpha, beta;
+    bool exact = false; // 불변 부분공간 도달 (근사가 정확해짐)
+    for (std::size_t j = 0; j < KRYLOV_DIM; ++j) {
+        const double* q = basis + j * n;
+        const double* qPrev = (j > 0) ? basis + (j - 1) * n : nullptr;
+        double* w = basis + (j + 1) * n;
+        multiply(q, w);
+        double a = dot(q, w);
+        double bPrev = (j > 0) ? beta[j - 1] : 0.0;
+        forEachPartition([&](std::size_t rowBegin, std::size_t rowEnd, std::size_t p) {
+            double sum = 0.0;
+            for (std::size_t i = rowBegin; i < rowEnd; ++i) {
+                w[i] -= a * q[i] + (qPrev ? bPrev * qPrev[i] : 0.0);
+                sum += w[i] * w[i];
+            }
+            m_partial[p] = sum;
+        });
+        double b = 0.0;
+        for (double v : m_partial) b += v;
+        b = std::sqrt(b);
+        alpha.push_back(a);
+        if (b <= 1e-12 * m_normBound) { exact = true; break; }
+        beta.push_back(b);
+        if (j + 1 < KRYLOV_DIM) {
+            forEachPartition([&](std::size_t rowBegin, std::size_t rowEnd, std::size_t) {
+                for (std::size_t i = rowBegin; i < rowEnd; ++i) w[i] /= b;
+            });
+        }
+    }
+
+    // 삼중대각 T_m 고유값 분해
+    std::size_t m = alpha.size();
+    std::vector<double> T(m * m, 0.0), theta, U;
+    for (std::size_t j = 0; j < m; ++j) {
+        T[j * m + j] = alpha[j];
+        if (j + 1 < m) { T[j * m + j + 1] = beta[j]; T[(j + 1) * m + j] = beta[j]; }
+    }
+    symmetricEigen(m, T, theta, U);
+
+    // 오차 추정이 허용치 안에 들 때까지 τ를 절반씩 줄임 (기저는 τ와 무관하므로 재사용)
+    double tau = (m_normBound * dt > MAX_STEP_NORM) ? MAX_STEP_NORM / m_normBound : dt;
+    double lastBeta = exact ? 0.0 : beta.back();
+    std::vector<double> coeff(m);
+    for (;;) {
+        for (std::size_t k = 0; k < m; ++k) {
+            double sum = 0.0;
+            for (std::size_t j = 0; j < m; ++j) sum += U[k * m + j] * std::exp(theta[j] * tau) * U[j];
+            coeff[k] = sum; // (e^{T τ} e_1)_k
+        }
+        if (lastBeta * std::fabs(coeff[m - 1]) <= TOLERANCE || tau * m_normBound < 1e-6) break;
+        tau *= 0.5;
+    }
+
+    // y <- ‖y‖ Σ_k coeff_k q_k
+    forEachPartition([&](std::size_t rowBegin, std::size_t rowEnd, std::size_t) {
+        for (std::size_t i = rowBegin; i < rowEnd; ++i) {
+            double sum = 0.0;
+            for (std::size_t k = 0; k < m; ++k) sum += coeff[k] * basis[k * n + i];
+            m_state[i] = beta0 * sum;
+        }
+    });
+    return tau;
+}
+
+// C(t) = Css + D⁻¹ y(t)
+void SparseZoneNetwork::concentrations(std::vector<double>& out) const {
+    out.assign(m_size, 0.0);
+    for (std::size_t r = 0; r < m_size; ++r) {
+        double c = m_steady[r] + m_state[r] / m_sqrtVolume[r];
+        out[m_order[r]] = (c < 0.0) ? 0.0 : c; // 농도는 음수가 될 수 없음
+    }
+}
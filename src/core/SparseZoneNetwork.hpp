@@ -0,0 +1,77 @@
+#ifndef SPARSE_ZONE_NETWORK_HPP
+#define SPARSE_ZONE_NETWORK_HPP
+
+#include <vector>
+#include <cstddef>
+#include "ZoneNetwork.hpp"
+#include "ThreadPool.hpp"
+
+// 건물 규모(수천~수만 구역)의 희소 다중 구역 해석기
+// ZoneNetwork와 같은 모델(dC/dt = A·C + b)을 연결 그래프 그대로 CSR 희소 행렬로 저장하고,
+// 고유값 분해 대신 Lanczos(Krylov 부분공간)로 행렬 지수의 작용 e^{Bτ}·y 를 근사해 시간을 전진함
+// 연결 그래프를 BFS로 스레드 수만큼 분할하고 구역 번호를 분할별로 연속되게 재배치한 뒤,
+// 행렬-벡터 곱과 벡터 연산을 분할 단위로 스레드 풀에서 병렬 실행
+// (분할 경계 구역의 유량 항은 매 곱셈마다 이웃 분할의 최신 값을 읽어 교환)
+class SparseZoneNetwork {
+public:
+    // 생성자: 병렬 실행에 사용할 스레드 풀
+    explicit SparseZoneNetwork(ThreadPool& pool);
+
+    // 모델 설명으로 희소 행렬 구성, 그래프 분할, 정상 상태 계산 후 t = 0으로 초기화
+    // numPartitions가 0이면 스레드 풀 크기 사용, 실패 시 false
+    bool build(const ZoneNetwork& network, std::size_t numPartitions = 0);
+
+    // 구역 수
+    std::size_t size() const;
+    // 분할 수
+    std::size_t numPartitions() const;
+    // 다른 분할과 연결된 경계 구역 수
+    std::size_t numBoundaryZones() const;
+
+    // 초기 상태(t = 0)로 되돌림
+    void reset();
+    // 현재 상태를 dt(분)만큼 전진
+    void advance(double dt);
+    // 현재 시간 (분)
+    double time() const;
+    // 현재 시간의 구역별 농도 (원래 구역 순서)
+    void concentrations(std::vector<double>& out) const;
+    // 정상 상태 농도 -A⁻¹b (원래 구역 순서)
+    const std::vector<double>& steadyState() const;
+
+    static const std::size_t KRYLOV_DIM; // Lanczos 부분공간 최대 차원
+    static const double MAX_STEP_NORM;   // 부분 단계 τ‖B‖의 초기 상한
+    static const double TOLERANCE;       // 정상 상태 CG 및 Krylov 근사 상대 허용치
+
+private:
+    ThreadPool& m_pool;                      // 병렬 실행용 스레드 풀
+    std::size_t m_size;                      // 구역 수
+    std::vector<std::size_t> m_rowStart;     // CSR 행 시작 위치 (재배치 순서, size + 1)
+    std::vector<std::size_t> m_column;       // CSR 열 인덱스
+    std::vector<double> m_value;             // CSR 값: 대칭화 행렬 B = D A D⁻¹
+    std::vector<std::size_t> m_partitionStart; // 분할별 행 시작 (numPartitions + 1)
+    std::vector<std::size_t> m_order;        // 재배치 순서 → 원래 구역 번호
+    std::size_t m_boundaryZones;             // 경계 구역 수
+    double m_normBound;                      // ‖B‖ 상한 (Gershgorin)
+    std::vector<double> m_sqrtVolume;        // √V_i (재배치 순서)
+    std::vector<double> m_steady;            // 정상 상태 농도 (재배치 순서)
+    std::vector<double> m_steadyOriginal;    // 정상 상태 농도 (원래 순서)
+    std::vector<double> m_initial;           // 초기 편차 D (C0 - Css)
+    std::vector<double> m_state;             // 현재 편차 y(t) = D (C(t) - Css)
+    double m_time;                           // 현재 시간 (분)
+    std::vector<double> m_basis;             // Lanczos 기저 (KRYLOV_DIM + 1개 벡터)
+    std::vector<double> m_partial;           // 분할별 부분합 (내적 병렬 축약용)
+
+    // 분할별로 body(rowBegin, rowEnd, partition) 병렬 실행
+    template <typename Body> void forEachPartition(const Body& body);
+    // y = B x (분할별 병렬)
+    void multiply(const double* x, double* y);
+    // 내적 (분할별 부분합을 고정 순서로 더해 결과가 스레드 수와 무관)
+    double dot(const double* a, const double* b);
+    // (-B) z = D b 를 Jacobi 전처리 켤레 기울기법으로 풀어 정상 상태 계산
+    bool solveSteadyState(const std::vector<double>& rhs);
+    // m_state <- e^{Bτ} m_state (τ는 dt를 넘지 않는 범위에서 오차 추정으로 결정), 실제 전진한 τ 반환
+    double krylovStep(double dt);
+};
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+// 생산자 스레드 하나와 소비자 스레드 하나 사이의 잠금 없는(lock-free) 고정 크기 원형 큐
+// 용량은 2의 거듭제곱으로 올림해 위치를 마스크로 자르고, 생산자는 꼬리(m_tail), 소비자는 머리(m_head)만 씀
+// 두 위치는 서로 다른 캐시 라인에 두고, 상대 위치는 캐시해 두었다가 공간/값이 모자랄 때만 다시 읽음
+// (가득 차거나 비어 있으면 기다리지 않고 바로 실패하므로 어느 쪽도 막히지 않음)
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(std::size_t capacity)
+        : m_buffer(roundUp(capacity)), m_mask(m_buffer.size() - 1),
+          m_head(0), m_cachedTail(0), m_tail(0), m_cachedHead(0) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    std::size_t capacity() const { return m_buffer.size(); }
+
+    // 생산자: 하나 넣기 (가득 차 있으면 false)
+    bool tryPush(const T& value) { return pushBulk(&value, 1) == 1; }
+
+    // 생산자: 최대 count개 넣고 넣은 개수 반환 (위치는 한 번만 공개)
+    std::size_t pushBulk(const T* values, std::size_t count) {
+        std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        std::size_t space = capacity() - (tail - m_cachedHead);
+        if (space < count) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            space = capacity() - (tail - m_cachedHead);
+        }
+        count = std::min(count, space);
+        for (std::size_t i = 0; i < count; ++i) m_buffer[(tail + i) & m_mask] = values[i];
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // 소비자: 최대 maxCount개 꺼내 out에 복사하고 꺼낸 개수 반환
+    std::size_t popBulk(T* out, std::size_t maxCount) {
+        std::size_t head = m_head.load(std::memory_order_relaxed);
+        std::size_t available = m_cachedTail - head;
+        if (available < maxCount) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            available = m_cachedTail - head;
+        }
+        std::size_t count = std::min(maxCount, available);
+        for (std::size_t i = 0; i < count; ++i) out[i] = m_buffer[(head + i) & m_mask];
+        m_head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    static const std::size_t CACHE_LINE = 64;
+
+    static std::size_t roundUp(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size *= 2;
+        return size;
+    }
+
+    std::vector<T> m_buffer;
+    const std::size_t m_mask;
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_head; // 소비자가 다음에 읽을 위치 (계속 증가, 마스크로 자름)
+    std::size_t m_cachedTail;                             // 소비자 전용: 마지막으로 읽은 꼬리
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_tail; // 생산자가 다음에 쓸 위치
+    std::size_t m_cachedHead;                             // 생산자 전용: 마지막으로 읽은 머리
+};
+
+#endif
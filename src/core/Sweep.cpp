@@ -0,0 +1,74 @@
+#include "Sweep.hpp"
+#include <cmath>
+
+// 작업 하나가 처리할 격자점 수 (작업 제출 비용 대비 충분히 크게)
+const std::size_t ParameterSweep::POINTS_PER_TASK = 4096;
+
+ParameterSweep::ParameterSweep(const SweepGrid& grid, const SweepOptions& options)
+    : m_grid(grid), m_options(options) {}
+
+std::size_t ParameterSweep::numPoints() const {
+    return m_grid.C0.size() * m_grid.S.size() * m_grid.K.size() *
+           m_grid.volume.size() * m_grid.passages.size() * m_grid.windows.size();
+}
+
+std::size_t ParameterSweep::columnsPerPoint() const { return 2 + m_options.sampleTimes.size(); }
+
+// 혼합 기수(mixed radix) 방식으로 평탄화된 인덱스 분해
+SweepIndex ParameterSweep::decode(std::size_t index) const {
+    SweepIndex idx;
+    idx.c0 = index % m_grid.C0.size(); index /= m_grid.C0.size();
+    idx.s = index % m_grid.S.size(); index /= m_grid.S.size();
+    idx.k = index % m_grid.K.size(); index /= m_grid.K.size();
+    idx.windows = index % m_grid.windows.size(); index /= m_grid.windows.size();
+    idx.passages = index % m_grid.passages.size(); index /= m_grid.passages.size();
+    idx.volume = index;
+    return idx;
+}
+
+// 축별 인덱스에 해당하는 모델 파라미터
+ModelParams ParameterSweep::paramsAt(const SweepIndex& idx) const {
+    ModelParams p;
+    int numPassages = m_grid.passages[idx.passages];
+    int numWindows = m_grid.windows[idx.windows];
+    p.C0 = m_grid.C0[idx.c0];
+    p.S = m_grid.S[idx.s] + numPassages * ConcentrationModel::S_ADJUST_PASSAGE + numWindows * ConcentrationModel::S_ADJUST_WINDOW;
+    p.K = m_grid.K[idx.k] + numPassages * ConcentrationModel::K_ADJUST_PASSAGE + numWindows * ConcentrationModel::K_ADJUST_WINDOW;
+    if (p.K < ConcentrationModel::MIN_K) p.K = ConcentrationModel::MIN_K; // K 최소값 보장
+    p.V = (m_grid.volume[idx.volume] < ConcentrationModel::MIN_VOLUME) ? ConcentrationModel::MIN_VOLUME : m_grid.volume[idx.volume];
+    return p;
+}
+
+// 임계값 도달 시간: C(t) = threshold 를 t에 대해 풀이
+// t = ln((C0 - Css) / (threshold - Css)) / K, threshold가 C0와 Css 사이에 있을 때만 해가 존재
+float ParameterSweep::timeToThreshold(const ModelParams& p, float threshold) {
+    if (p.C0 == threshold) return 0.0f; // 시작부터 임계값
+    float css = ConcentrationModel::steadyState(p);
+    float lo = std::fmin(p.C0, css), hi = std::fmax(p.C0, css);
+    if (threshold <= lo || threshold >= hi) return -1.0f; // 지수 접근이므로 Css 자체에는 도달하지 않음
+    return std::log((p.C0 - css) / (threshold - css)) / p.K;
+}
+
+// 격자점 범위 평가
+void ParameterSweep::evaluateRange(std::size_t begin, std::size_t end, float* out) const {
+    std::size_t columns = columnsPerPoint();
+    for (std::size_t i = begin; i < end; ++i) {
+        ModelParams p = paramsAt(decode(i));
+        float* row = out + (i - begin) * columns;
+        row[0] = ConcentrationModel::steadyState(p);             // 정상 상태 농도
+        row[1] = timeToThreshold(p, m_options.threshold);        // 임계값 도달 시간
+        for (std::size_t j = 0; j < m_options.sampleTimes.size(); ++j) {
+            row[2 + j] = ConcentrationModel::concentrationAt(p, m_options.sampleTimes[j]); // 지정 시간 농도
+        }
+    }
+}
+
+// 전체 격자 병렬 평가
+void ParameterSweep::run(ThreadPool& pool, std::vector<float>& out) const {
+    std::size_t total = numPoints();
+    std::size_t columns = columnsPerPoint();
+    out.resize(total * columns);
+    pool.parallelFor(0, total, POINTS_PER_TASK, [this, &out, columns](std::size_t begin, std::size_t end) {
+        evaluateRange(begin, end, out.data() + begin * columns); // 각 작업은 겹치지 않는 구간에만 기록
+    });
+}
@@ -0,0 +1,60 @@
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include <vector>
+#include <cstddef>
+#include "Model.hpp"
+#include "ThreadPool.hpp"
+
+// 파라미터 스윕 격자: 각 축 값들의 데카르트 곱이 하나의 격자점이 됨
+// S, K는 밀폐 상태 기준값이며, 통로/창문 개수에 따른 조정량이 격자점마다 더해짐
+struct SweepGrid {
+    std::vector<float> C0;     // 초기 농도 축
+    std::vector<float> S;      // 기본 유입 속도 축
+    std::vector<float> K;      // 기본 제거 상수 축
+    std::vector<float> volume; // 방 부피 축 (m³)
+    std::vector<int> passages; // 통로 개수 축
+    std::vector<int> windows;  // 창문 개수 축
+};
+
+// 격자점 하나의 축별 인덱스
+struct SweepIndex {
+    std::size_t c0, s, k, volume, passages, windows;
+};
+
+// 격자점별 요약 계산 옵션
+struct SweepOptions {
+    float threshold;                // 도달 시간을 구할 농도 임계값
+    std::vector<float> sampleTimes; // 농도를 기록할 시간들 (분)
+};
+
+// 파라미터 스윕 실행기: 격자점마다 [정상 상태 S/(kV), 임계값 도달 시간, 지정 시간별 농도...]를 계산
+class ParameterSweep {
+public:
+    ParameterSweep(const SweepGrid& grid, const SweepOptions& options);
+
+    // 전체 격자점 수
+    std::size_t numPoints() const;
+    // 격자점당 요약 값 개수 (2 + 지정 시간 수)
+    std::size_t columnsPerPoint() const;
+    // 평탄화된 격자점 인덱스를 축별 인덱스로 변환 (C0 축이 가장 빠르게 변함)
+    SweepIndex decode(std::size_t index) const;
+    // 축별 인덱스에 해당하는 모델 파라미터 (개구부 조정량 반영)
+    ModelParams paramsAt(const SweepIndex& idx) const;
+
+    // [begin, end) 격자점의 요약을 out에 기록 (out은 (end-begin)*columnsPerPoint() 크기)
+    void evaluateRange(std::size_t begin, std::size_t end, float* out) const;
+    // 모든 격자점을 스레드 풀에서 병렬 평가 (결과는 격자점 순서의 평탄화된 배열)
+    void run(ThreadPool& pool, std::vector<float>& out) const;
+
+    // 농도가 threshold에 처음 도달하는 시간 (도달하지 않으면 -1)
+    static float timeToThreshold(const ModelParams& p, float threshold);
+
+    static const std::size_t POINTS_PER_TASK; // 작업 하나가 처리할 격자점 수
+
+private:
+    const SweepGrid& m_grid; // 스윕 격자 (실행기보다 오래 살아 있어야 함)
+    SweepOptions m_options;  // 요약 계산 옵션
+};
+
+#endif
@@ -0,0 +1,120 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+// 현재 스레드가 속한 풀과 작업자 인덱스 (작업자 내부에서 제출 시 자기 큐 사용)
+static thread_local const ThreadPool* t_currentPool = nullptr;
+static thread_local unsigned t_workerIndex = 0;
+
+// ThreadPool 생성자: 작업자 큐 및 스레드 생성
+ThreadPool::ThreadPool(unsigned numThreads)
+    : m_queued(0), m_pending(0), m_stop(false), m_nextQueue(0) {
+    if (numThreads == 0) numThreads = std::max(1u, std::thread::hardware_concurrency()); // 코어 수 자동 감지
+    for (unsigned i = 0; i < numThreads; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (unsigned i = 0; i < numThreads; ++i) {
+        m_threads.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+// ThreadPool 소멸자: 남은 작업 처리 후 모든 스레드 합류
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_stop = true;
+    }
+    m_workAvailable.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+unsigned ThreadPool::size() const { return static_cast<unsigned>(m_threads.size()); }
+
+// 작업 제출
+void ThreadPool::submit(std::function<void()> task) {
+    unsigned target;
+    if (t_currentPool == this) { // 작업자 스레드 내부에서 제출하면 자기 큐 뒤에 추가 (지역성 유지)
+        target = t_workerIndex;
+    } else { // 외부 스레드에서 제출하면 큐를 순환하며 배정
+        target = m_nextQueue.fetch_add(1, std::memory_order_relaxed) % size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_queues[target]->mutex);
+        m_queues[target]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        ++m_queued;
+        ++m_pending;
+    }
+    m_workAvailable.notify_one(); // 대기 중인 작업자 하나 깨우기
+}
+
+// 모든 작업 완료 대기
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(m_stateMutex);
+    m_allDone.wait(lock, [this] { return m_pending == 0; });
+}
+
+// 범위 병렬 실행
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                             const std::function<void(std::size_t, std::size_t)>& body) {
+    if (begin >= end) return;
+    if (grain == 0) grain = 1;
+    for (std::size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grain) {
+        std::size_t chunkEnd = std::min(end, chunkBegin + grain);
+        submit([&body, chunkBegin, chunkEnd] { body(chunkBegin, chunkEnd); }); // body는 wait() 동안 유효함
+    }
+    wait();
+}
+
+// 자기 큐 뒤에서 꺼내거나, 다른 작업자 큐 앞에서 훔쳐 오기
+bool ThreadPool::popOrSteal(unsigned index, std::function<void()>& task) {
+    {
+        WorkerQueue& own = *m_queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back()); // 최근에 넣은 작업 (캐시 지역성 유리)
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+    for (unsigned offset = 1; offset < size(); ++offset) {
+        WorkerQueue& victim = *m_queues[(index + offset) % size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front()); // 가장 오래된 작업을 훔침 (큰 조각일 가능성 높음)
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+// 작업자 스레드 본체
+void ThreadPool::workerLoop(unsigned index) {
+    t_currentPool = this;
+    t_workerIndex = index;
+    while (true) {
+        std::function<void()> task;
+        if (popOrSteal(index, task)) {
+            {
+                std::lock_guard<std::mutex> lock(m_stateMutex);
+                --m_queued;
+            }
+            task(); // 작업 실행
+            bool done;
+            {
+                std::lock_guard<std::mutex> lock(m_stateMutex);
+                done = (--m_pending == 0);
+            }
+            if (done) m_allDone.notify_all(); // 모든 작업 완료 시 대기자 깨우기
+            continue;
+        }
+        // 꺼낼 작업이 없으면 새 작업 또는 종료 요청까지 대기
+        std::unique_lock<std::mutex> lock(m_stateMutex);
+        m_workAvailable.wait(lock, [this] { return m_stop || m_queued > 0; });
+        if (m_stop && m_queued == 0) return;
+    }
+}
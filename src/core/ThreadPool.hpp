@@ -0,0 +1,58 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <atomic>
+#include <cstddef>
+
+// 작업 훔치기(work-stealing) 스레드 풀
+// 각 작업자는 자기 큐의 뒤에서 작업을 꺼내고, 비어 있으면 다른 작업자 큐의 앞에서 훔쳐 옴
+// (작업은 예외를 던지지 않아야 함)
+class ThreadPool {
+public:
+    // 생성자: 작업자 스레드 수 (0이면 하드웨어 코어 수 사용)
+    explicit ThreadPool(unsigned numThreads = 0);
+    // 소멸자: 남은 작업을 모두 처리한 뒤 스레드 종료
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 작업자 스레드 수 반환
+    unsigned size() const;
+    // 작업 제출 (작업자 스레드에서 호출하면 자기 큐에, 외부에서 호출하면 순환 배정)
+    void submit(std::function<void()> task);
+    // 제출된 모든 작업이 끝날 때까지 대기 (작업자 스레드 내부에서 호출 금지)
+    void wait();
+    // [begin, end) 범위를 grain 크기 조각으로 나누어 병렬 실행 후 완료까지 대기
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                     const std::function<void(std::size_t, std::size_t)>& body);
+
+private:
+    // 작업자별 작업 큐
+    struct WorkerQueue {
+        std::mutex mutex;                        // 큐 보호용 뮤텍스
+        std::deque<std::function<void()>> tasks; // 대기 중인 작업들
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues; // 작업자별 큐
+    std::vector<std::thread> m_threads;                 // 작업자 스레드들
+    std::mutex m_stateMutex;                // 아래 카운터 및 조건 변수 보호용 뮤텍스
+    std::condition_variable m_workAvailable; // 새 작업 알림
+    std::condition_variable m_allDone;       // 모든 작업 완료 알림
+    std::size_t m_queued;                    // 큐에 들어 있는 작업 수
+    std::size_t m_pending;                   // 제출 후 아직 끝나지 않은 작업 수
+    bool m_stop;                             // 종료 요청 플래그
+    std::atomic<unsigned> m_nextQueue;       // 외부 제출 시 순환 배정용 인덱스
+
+    void workerLoop(unsigned index);                               // 작업자 스레드 본체
+    bool popOrSteal(unsigned index, std::function<void()>& task);  // 자기 큐에서 꺼내거나 훔쳐 오기
+};
+
+#endif
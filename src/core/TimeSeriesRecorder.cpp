@@ -0,0 +1,210 @@
+#include "TimeSeriesRecorder.hpp"
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+const std::size_t TimeSeriesRecorder::DEFAULT_CAPACITY = 1 << 16; // 60 Hz 기록이면 18분 분량, 표본 32바이트 × 65536 = 2 MB
+const std::size_t TimeSeriesRecorder::BLOCK_SAMPLES = 4096;
+const std::uint32_t TimeSeriesRecorder::FORMAT_VERSION = 2;
+const int TimeSeriesRecorder::IDLE_SLEEP_MS = 2;
+
+static const char MAGIC[8] = {'I', 'A', 'P', 'S', 'R', 'E', 'C', '\0'};
+static const std::uint32_t COLUMN_COUNT = 6;    // t, C, S, K, particles, series
+static const std::uint32_t V1_COLUMN_COUNT = 5; // 버전 1: series 열 없음
+static const std::size_t BYTES_PER_SAMPLE = sizeof(double) + 3 * sizeof(float) + 2 * sizeof(std::uint32_t);
+
+// 파일 앞부분
+struct RecordHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t columnCount;
+};
+// 블록 앞부분 (뒤따르는 f64 열이 8바이트 정렬되도록 8바이트)
+struct BlockHeader {
+    std::uint32_t count;
+    std::uint32_t reserved;
+};
+static_assert(sizeof(RecordHeader) == 16 && sizeof(BlockHeader) == 8, "file layout");
+
+TimeSeriesRecorder::TimeSeriesRecorder()
+    : m_format(Format::Csv), m_overflow(Overflow::Drop), m_recording(false), m_stopRequested(false), m_written(0), m_dropped(0) {}
+
+TimeSeriesRecorder::~TimeSeriesRecorder() { stop(); }
+
+TimeSeriesRecorder::Format TimeSeriesRecorder::formatFor(const std::string& filename) {
+    std::size_t dot = filename.rfind('.');
+    std::string extension = dot == std::string::npos ? "" : filename.substr(dot);
+    return extension == ".csv" || extension == ".CSV" ? Format::Csv : Format::Binary;
+}
+
+bool TimeSeriesRecorder::start(const std::string& filename, Format format, Overflow overflow, std::size_t capacity) {
+    stop();
+    if (format == Format::Binary && std::endian::native != std::endian::little) {
+        std::cerr << "Error: Binary recordings are only supported on little-endian hosts" << std::endl;
+        return false;
+    }
+    m_file.open(filename, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        std::cerr << "Error: Could not open recording file: " << filename << std::endl;
+        return false;
+    }
+    if (format == Format::Csv) {
+        m_file << "t,C,S,K,particles,series\n";
+    } else {
+        RecordHeader header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = FORMAT_VERSION;
+        header.columnCount = COLUMN_COUNT;
+        m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    m_filename = filename;
+    m_format = format;
+    m_overflow = overflow;
+    m_ring = std::make_unique<SpscRing<RecordSample>>(capacity);
+    m_stopRequested.store(false, std::memory_order_relaxed);
+    m_written.store(0, std::memory_order_relaxed);
+    m_dropped = 0;
+    m_recording = true;
+    m_writer = std::thread(&TimeSeriesRecorder::writerLoop, this);
+    return true;
+}
+
+void TimeSeriesRecorder::stop() {
+    if (!m_recording) return;
+    m_recording = false;
+    m_stopRequested.store(true, std::memory_order_release); // 이전에 넣은 표본은 모두 쓰기 스레드에 보임
+    m_writer.join();
+    m_file.close();
+    if (!m_file) std::cerr << "Error: Could not write recording file: " << m_filename << std::endl;
+    m_file.clear();
+    m_ring.reset();
+}
+
+bool TimeSeriesRecorder::recording() const { return m_recording; }
+std::uint64_t TimeSeriesRecorder::writtenCount() const { return m_written.load(std::memory_order_acquire); }
+std::uint64_t TimeSeriesRecorder::droppedCount() const { return m_dropped; }
+const std::string& TimeSeriesRecorder::filename() const { return m_filename; }
+
+bool TimeSeriesRecorder::record(const RecordSample& sample) { return recordBatch(&sample, 1) == 1; }
+
+std::size_t TimeSeriesRecorder::recordBatch(const RecordSample* samples, std::size_t count) {
+    if (!m_recording) return 0;
+    std::size_t pushed = m_ring->pushBulk(samples, count);
+    if (m_overflow == Overflow::Wait) {
+        while (pushed < count) { // 쓰기 스레드가 비울 때까지 양보 (잠금 없이 다시 시도)
+            std::this_thread::yield();
+            pushed += m_ring->pushBulk(samples + pushed, count - pushed);
+        }
+    }
+    m_dropped += count - pushed;
+    return pushed;
+}
+
+// 큐를 BLOCK_SAMPLES개씩 비워 쓰고, 비었으면 IDLE_SLEEP_MS 동안 쉼
+// 종료 요청은 꺼내기 전에 확인하므로 요청 전에 넣은 표본은 마지막 빈 꺼내기 전에 모두 쓰임
+void TimeSeriesRecorder::writerLoop() {
+    std::vector<RecordSample> batch(BLOCK_SAMPLES);
+    std::string text;
+    std::vector<char> block;
+    while (true) {
+        bool stopping = m_stopRequested.load(std::memory_order_acquire);
+        std::size_t count = m_ring->popBulk(batch.data(), batch.size());
+        if (count > 0) {
+            if (m_format == Format::Csv) writeCsv(batch.data(), count, text);
+            else writeBlock(batch.data(), count, block);
+            m_written.fetch_add(count, std::memory_order_release);
+            continue;
+        }
+        if (stopping) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_SLEEP_MS));
+    }
+    m_file.flush();
+}
+
+// 숫자는 to_chars의 최단 왕복 표현 (다시 읽으면 같은 값)
+void TimeSeriesRecorder::writeCsv(const RecordSample* samples, std::size_t count, std::string& text) {
+    const std::size_t MAX_LINE = 128; // 값 6개의 최단 표현 + 구분자
+    text.resize(count * MAX_LINE);
+    char* p = text.data();
+    char* end = p + text.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        const RecordSample& s = samples[i];
+        p = std::to_chars(p, end, s.t).ptr; *p++ = ',';
+        p = std::to_chars(p, end, s.C).ptr; *p++ = ',';
+        p = std::to_chars(p, end, s.S).ptr; *p++ = ',';
+        p = std::to_chars(p, end, s.K).ptr; *p++ = ',';
+        p = std::to_chars(p, end, s.particles).ptr; *p++ = ',';
+        p = std::to_chars(p, end, s.series).ptr; *p++ = '\n';
+    }
+    m_file.write(text.data(), p - text.data());
+}
+
+// 표본(행)을 열 배열로 옮겨 블록 하나로 씀
+void TimeSeriesRecorder::writeBlock(const RecordSample* samples, std::size_t count, std::vector<char>& block) {
+    block.resize(sizeof(BlockHeader) + count * BYTES_PER_SAMPLE);
+    BlockHeader header{static_cast<std::uint32_t>(count), 0};
+    char* p = block.data();
+    std::memcpy(p, &header, sizeof(header));
+    p += sizeof(header);
+    for (std::size_t i = 0; i < count; ++i, p += sizeof(double)) std::memcpy(p, &samples[i].t, sizeof(double));
+    for (std::size_t i = 0; i < count; ++i, p += sizeof(float)) std::memcpy(p, &samples[i].C, sizeof(float));
+    for (std::size_t i = 0; i < count; ++i, p += sizeof(float)) std::memcpy(p, &samples[i].S, sizeof(float));
+    for (std::size_t i = 0; i < count; ++i, p += sizeof(float)) std::memcpy(p, &samples[i].K, sizeof(float));
+    for (std::size_t i = 0; i < count; ++i, p += sizeof(std::uint32_t)) std::memcpy(p, &samples[i].particles, sizeof(std::uint32_t));
+    for (std::size_t i = 0; i < count; ++i, p += sizeof(std::uint32_t)) std::memcpy(p, &samples[i].series, sizeof(std::uint32_t));
+    m_file.write(block.data(), static_cast<std::streamsize>(block.size()));
+}
+
+bool TimeSeriesRecorder::readBinary(const std::string& filename, std::vector<RecordSample>& samples) {
+    samples.clear();
+    if (std::endian::native != std::endian::little) {
+        std::cerr << "Error: Binary recordings are only supported on little-endian hosts" << std::endl;
+        return false;
+    }
+    std::ifstream inFile(filename, std::ios::binary);
+    if (!inFile.is_open()) {
+        std::cerr << "Error: Could not open recording file: " << filename << std::endl;
+        return false;
+    }
+    RecordHeader header;
+    if (!inFile.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        std::cerr << "Error: Not a recording file: " << filename << std::endl;
+        return false;
+    }
+    std::uint32_t columns = header.version == 1 ? V1_COLUMN_COUNT : COLUMN_COUNT;
+    if (header.version == 0 || header.version > FORMAT_VERSION || header.columnCount != columns) {
+        std::cerr << "Error: Recording file version " << header.version << " is not supported (latest "
+                  << FORMAT_VERSION << "): " << filename << std::endl;
+        return false;
+    }
+    std::vector<char> block;
+    BlockHeader blockHeader;
+    while (inFile.read(reinterpret_cast<char*>(&blockHeader), sizeof(blockHeader))) {
+        std::size_t count = blockHeader.count;
+        bool hasSeries = columns == COLUMN_COUNT;
+        if (count <= BLOCK_SAMPLES) block.resize(count * (hasSeries ? BYTES_PER_SAMPLE : BYTES_PER_SAMPLE - sizeof(std::uint32_t))); // 파일의 개수는 검사 후에만 할당에 사용
+        if (count > BLOCK_SAMPLES || !inFile.read(block.data(), static_cast<std::streamsize>(block.size()))) {
+            std::cerr << "Error: Truncated or corrupt block in recording file: " << filename << std::endl;
+            return false;
+        }
+        std::size_t first = samples.size();
+        samples.resize(first + count);
+        const char* p = block.data();
+        for (std::size_t i = 0; i < count; ++i, p += sizeof(double)) std::memcpy(&samples[first + i].t, p, sizeof(double));
+        for (std::size_t i = 0; i < count; ++i, p += sizeof(float)) std::memcpy(&samples[first + i].C, p, sizeof(float));
+        for (std::size_t i = 0; i < count; ++i, p += sizeof(float)) std::memcpy(&samples[first + i].S, p, sizeof(float));
+        for (std::size_t i = 0; i < count; ++i, p += sizeof(float)) std::memcpy(&samples[first + i].K, p, sizeof(float));
+        for (std::size_t i = 0; i < count; ++i, p += sizeof(std::uint32_t)) std::memcpy(&samples[first + i].particles, p, sizeof(std::uint32_t));
+        for (std::size_t i = 0; i < count; ++i) {
+            if (hasSeries) { std::memcpy(&samples[first + i].series, p, sizeof(std::uint32_t)); p += sizeof(std::uint32_t); }
+            else samples[first + i].series = 0;
+        }
+    }
+    if (inFile.gcount() != 0) { // 블록 머리글 중간에서 끝남
+        std::cerr << "Error: Truncated recording file: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
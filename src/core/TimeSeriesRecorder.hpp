@@ -0,0 +1,90 @@
+#ifndef TIME_SERIES_RECORDER_HPP
+#define TIME_SERIES_RECORDER_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+#include "SpscRing.hpp"
+
+// 기록하는 시계열 표본 하나
+struct RecordSample {
+    double t;                // 시뮬레이션 시간 (분)
+    float C;                 // 농도 C(t)
+    float S, K;              // 유입 속도, 제거 상수
+    std::uint32_t particles; // 표시 파티클 수
+    std::uint32_t series;    // 계열 번호 (시간이 0부터 다시 시작하거나 건너뛸 때마다 다른 값, 배치 기록은 시나리오 인덱스)
+};
+
+// 시계열 기록기 (SFML 비의존 코어)
+// 생산자 스레드는 표본을 잠금 없는 SPSC 원형 큐에 넣기만 하고, 전용 쓰기 스레드가 큐를 비워 파일에 씀
+// 큐가 가득 차면 Drop 정책은 표본을 버리고 개수만 세며(렌더링/시뮬레이션 루프가 절대 막히지 않음),
+// Wait 정책은 자리가 날 때까지 양보하며 기다림 (배치 엔진처럼 모든 표본이 필요한 경우)
+// start(), record(), stop()은 모두 같은 생산자 스레드에서 호출
+//
+// 파일 형식:
+//   CSV:    "t,C,S,K,particles,series" 머리글 뒤에 표본마다 한 줄
+//   바이너리(리틀 엔디언 열 우선):
+//     [헤더 16바이트: 식별자 "IAPSREC\0", 버전 u32, 열 수 u32]
+//     [블록 반복: {표본 수 u32, 예약 u32}, t f64[n], C f32[n], S f32[n], K f32[n], particles u32[n], series u32[n]]
+//     (버전 1은 series 열이 없는 5열이며 읽으면 series는 0)
+//     블록은 최대 BLOCK_SAMPLES개씩이며 마지막 블록만 짧을 수 있음 (열마다 연속이라 한 열만 읽거나 압축하기 쉬움)
+class TimeSeriesRecorder {
+public:
+    enum class Format { Csv, Binary };
+    enum class Overflow { Drop, Wait };
+
+    TimeSeriesRecorder();
+    ~TimeSeriesRecorder(); // 기록 중이면 stop()
+
+    TimeSeriesRecorder(const TimeSeriesRecorder&) = delete;
+    TimeSeriesRecorder& operator=(const TimeSeriesRecorder&) = delete;
+
+    // 파일을 열고 쓰기 스레드 시작 (이미 기록 중이면 먼저 멈춤, 실패하면 false)
+    bool start(const std::string& filename, Format format, Overflow overflow = Overflow::Drop, std::size_t capacity = DEFAULT_CAPACITY);
+    // 큐에 남은 표본까지 모두 쓰고 파일을 닫음
+    void stop();
+    bool recording() const;
+
+    // 표본 넣기 (기록 중이 아니거나 Drop 정책에서 큐가 가득 차면 false)
+    bool record(const RecordSample& sample);
+    // 표본 count개 넣기 (넣은 개수 반환)
+    std::size_t recordBatch(const RecordSample* samples, std::size_t count);
+
+    // 이번 기록에서 파일에 쓴 표본 수 / 큐가 가득 차 버린 표본 수
+    std::uint64_t writtenCount() const;
+    std::uint64_t droppedCount() const;
+    const std::string& filename() const;
+
+    // 확장자가 .csv이면 CSV, 아니면 바이너리
+    static Format formatFor(const std::string& filename);
+    // 바이너리 기록 파일 읽기 (형식 오류면 false, 오류 출력)
+    static bool readBinary(const std::string& filename, std::vector<RecordSample>& samples);
+
+    static const std::size_t DEFAULT_CAPACITY; // 기본 큐 용량 (표본 수)
+    static const std::size_t BLOCK_SAMPLES;    // 쓰기 스레드가 한 번에 꺼내는 최대 표본 수 (바이너리 블록 크기)
+    static const std::uint32_t FORMAT_VERSION; // 바이너리 형식 버전
+    static const int IDLE_SLEEP_MS;            // 큐가 비었을 때 쓰기 스레드가 쉬는 시간 (밀리초)
+
+private:
+    std::unique_ptr<SpscRing<RecordSample>> m_ring;
+    std::ofstream m_file;
+    std::string m_filename;
+    Format m_format;
+    Overflow m_overflow;
+    bool m_recording;                     // 생산자 전용
+    std::atomic<bool> m_stopRequested;    // 생산자 → 쓰기 스레드: 큐를 비운 뒤 종료
+    std::atomic<std::uint64_t> m_written; // 쓰기 스레드가 쓴 표본 수
+    std::uint64_t m_dropped;              // 생산자 전용
+    std::thread m_writer;
+
+    void writerLoop();                                      // 쓰기 스레드 본체
+    void writeCsv(const RecordSample* samples, std::size_t count, std::string& text); // CSV 줄로 변환해 쓰기
+    void writeBlock(const RecordSample* samples, std::size_t count, std::vector<char>& block); // 열 우선 블록 하나 쓰기
+};
+
+#endif
@@ -0,0 +1,210 @@
+#include "TrajectoryKernel.hpp"
+#include <cstring>
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IAPS_KERNEL_X86 1 // GCC/Clang x86: target 속성으로 ISA별 함수를 한 파일에 컴파일
+#include <immintrin.h>
+#endif
+
+// exp 근사 상수 (Cephes expf 방식: exp(x) = 2^n * exp(r), |r| <= ln2/2)
+static const float EXP_HI = 88.02f;              // 127·ln2(88.0297) 아래: 반올림한 n이 127을 넘으면 2^n 지수 비트가 255(inf)가 됨
+static const float EXP_LO = -87.3365447505531f;  // 이 값보다 작으면 2^n 지수 하한 미만
+static const float LOG2E = 1.44269504088896341f; // log2(e)
+static const float LN2_HI = 0.693359375f;        // ln2 상위 부분 (Cody-Waite 분할)
+static const float LN2_LO = -2.12194440e-4f;     // ln2 하위 부분
+// exp(r) 다항식 계수 (r^2 이상 항)
+static const float P0 = 1.9875691500e-4f;
+static const float P1 = 1.3981999507e-3f;
+static const float P2 = 8.3334519073e-3f;
+static const float P3 = 4.1665795894e-2f;
+static const float P4 = 1.6666665459e-1f;
+static const float P5 = 5.0000001201e-1f;
+
+const float TrajectoryKernel::EXP_REL_ERROR_BOUND = 3e-7f; // 2 ulp 이내 + 여유
+
+// 정상 상태 판정 기준 (ConcentrationModel::steadyState와 동일)
+static const float KV_EPSILON = 1e-9f;
+
+// 스칼라 근사 exp
+float TrajectoryKernel::fastExp(float x) {
+    x = (x > EXP_HI) ? EXP_HI : ((x < EXP_LO) ? EXP_LO : x); // 범위 제한
+    float fn = x * LOG2E;
+    fn = (fn >= 0.f) ? static_cast<float>(static_cast<int32_t>(fn + 0.5f)) : static_cast<float>(static_cast<int32_t>(fn - 0.5f)); // 가장 가까운 정수
+    float r = x - fn * LN2_HI - fn * LN2_LO; // r = x - n*ln2
+    float z = r * r;
+    float y = P0;
+    y = y * r + P1; y = y * r + P2; y = y * r + P3; y = y * r + P4; y = y * r + P5;
+    y = y * z + r + 1.0f;
+    int32_t bits = (static_cast<int32_t>(fn) + 127) << 23; // 2^n 을 float 비트로 직접 구성
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return y * scale;
+}
+
+// --- 스칼라 구현 ---
+static void evaluateScalar(const float* t, const float* C0, const float* S, const float* K, const float* V,
+                           float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        float kv = K[i] * V[i];
+        float css = (kv > KV_EPSILON) ? S[i] / kv : 0.f; // S/(kV)
+        float c = (C0[i] - css) * TrajectoryKernel::fastExp(-K[i] * t[i]) + css;
+        out[i] = (c < 0.f) ? 0.f : c;
+    }
+}
+
+static void trajectoryScalar(float amplitude, float css, float k, const float* t, float* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        float c = amplitude * TrajectoryKernel::fastExp(-k * t[i]) + css;
+        out[i] = (c < 0.f) ? 0.f : c;
+    }
+}
+
+#ifdef IAPS_KERNEL_X86
+// --- SSE2 구현 (float 4개씩) ---
+__attribute__((target("sse2")))
+static inline __m128 expSse2(__m128 x) {
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(EXP_LO)), _mm_set1_ps(EXP_HI));
+    __m128i ni = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(LOG2E))); // 기본 반올림 모드(가장 가까운 정수)
+    __m128 fn = _mm_cvtepi32_ps(ni);
+    __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(fn, _mm_set1_ps(LN2_HI))), _mm_mul_ps(fn, _mm_set1_ps(LN2_LO)));
+    __m128 z = _mm_mul_ps(r, r);
+    __m128 y = _mm_set1_ps(P0);
+    y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(P1));
+    y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(P2));
+    y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(P3));
+    y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(P4));
+    y = _mm_add_ps(_mm_mul_ps(y, r), _mm_set1_ps(P5));
+    y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, z), r), _mm_set1_ps(1.0f));
+    __m128i bits = _mm_slli_epi32(_mm_add_epi32(ni, _mm_set1_epi32(127)), 23);
+    return _mm_mul_ps(y, _mm_castsi128_ps(bits));
+}
+
+__attribute__((target("sse2")))
+static void evaluateSse2(const float* t, const float* C0, const float* S, const float* K, const float* V,
+                         float* out, std::size_t n) {
+    std::size_t i = 0;
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) {
+        __m128 k = _mm_loadu_ps(K + i);
+        __m128 kv = _mm_mul_ps(k, _mm_loadu_ps(V + i));
+        __m128 css = _mm_and_ps(_mm_cmpgt_ps(kv, _mm_set1_ps(KV_EPSILON)), _mm_div_ps(_mm_loadu_ps(S + i), kv)); // kV가 0에 가까우면 0
+        __m128 e = expSse2(_mm_sub_ps(zero, _mm_mul_ps(k, _mm_loadu_ps(t + i))));
+        __m128 c = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(C0 + i), css), e), css);
+        _mm_storeu_ps(out + i, _mm_max_ps(c, zero));
+    }
+    evaluateScalar(t + i, C0 + i, S + i, K + i, V + i, out + i, n - i); // 나머지 원소
+}
+
+__attribute__((target("sse2")))
+static void trajectorySse2(float amplitude, float css, float k, const float* t, float* out, std::size_t n) {
+    std::size_t i = 0;
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 negK = _mm_set1_ps(-k), amp = _mm_set1_ps(amplitude), cssV = _mm_set1_ps(css);
+    for (; i + 4 <= n; i += 4) {
+        __m128 c = _mm_add_ps(_mm_mul_ps(amp, expSse2(_mm_mul_ps(negK, _mm_loadu_ps(t + i)))), cssV);
+        _mm_storeu_ps(out + i, _mm_max_ps(c, zero));
+    }
+    trajectoryScalar(amplitude, css, k, t + i, out + i, n - i);
+}
+
+// --- AVX2 + FMA 구현 (float 8개씩) ---
+__attribute__((target("avx2,fma")))
+static inline __m256 expAvx2(__m256 x) {
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(EXP_LO)), _mm256_set1_ps(EXP_HI));
+    __m256 fn = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(LOG2E)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(fn, _mm256_set1_ps(LN2_HI), x);
+    r = _mm256_fnmadd_ps(fn, _mm256_set1_ps(LN2_LO), r);
+    __m256 z = _mm256_mul_ps(r, r);
+    __m256 y = _mm256_set1_ps(P0);
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(P1));
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(P2));
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(P3));
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(P4));
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(P5));
+    y = _mm256_add_ps(_mm256_fmadd_ps(y, z, r), _mm256_set1_ps(1.0f));
+    __m256i bits = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(fn), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(bits));
+}
+
+__attribute__((target("avx2,fma")))
+static void evaluateAvx2(const float* t, const float* C0, const float* S, const float* K, const float* V,
+                         float* out, std::size_t n) {
+    std::size_t i = 0;
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= n; i += 8) {
+        __m256 k = _mm256_loadu_ps(K + i);
+        __m256 kv = _mm256_mul_ps(k, _mm256_loadu_ps(V + i));
+        __m256 css = _mm256_and_ps(_mm256_cmp_ps(kv, _mm256_set1_ps(KV_EPSILON), _CMP_GT_OQ), _mm256_div_ps(_mm256_loadu_ps(S + i), kv));
+        __m256 e = expAvx2(_mm256_sub_ps(zero, _mm256_mul_ps(k, _mm256_loadu_ps(t + i))));
+        __m256 c = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(C0 + i), css), e, css);
+        _mm256_storeu_ps(out + i, _mm256_max_ps(c, zero));
+    }
+    evaluateScalar(t + i, C0 + i, S + i, K + i, V + i, out + i, n - i);
+}
+
+__attribute__((target("avx2,fma")))
+static void trajectoryAvx2(float amplitude, float css, float k, const float* t, float* out, std::size_t n) {
+    std::size_t i = 0;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 negK = _mm256_set1_ps(-k), amp = _mm256_set1_ps(amplitude), cssV = _mm256_set1_ps(css);
+    for (; i + 8 <= n; i += 8) {
+        __m256 c = _mm256_fmadd_ps(amp, expAvx2(_mm256_mul_ps(negK, _mm256_loadu_ps(t + i))), cssV);
+        _mm256_storeu_ps(out + i, _mm256_max_ps(c, zero));
+    }
+    trajectoryScalar(amplitude, css, k, t + i, out + i, n - i);
+}
+#endif
+
+// 현재 CPU에서 사용할 수 있는지 확인
+bool TrajectoryKernel::isaSupported(Isa isa) {
+    switch (isa) {
+        case Isa::Scalar: return true;
+#ifdef IAPS_KERNEL_X86
+        case Isa::SSE2: return __builtin_cpu_supports("sse2");
+        case Isa::AVX2: return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+        default: return false;
+    }
+}
+
+// 가장 넓은 지원 구현 선택 (최초 호출 시 한 번만 판정)
+TrajectoryKernel::Isa TrajectoryKernel::activeIsa() {
+    static const Isa selected = isaSupported(Isa::AVX2) ? Isa::AVX2 : (isaSupported(Isa::SSE2) ? Isa::SSE2 : Isa::Scalar);
+    return selected;
+}
+
+const char* TrajectoryKernel::isaName(Isa isa) {
+    switch (isa) {
+        case Isa::SSE2: return "sse2";
+        case Isa::AVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+void TrajectoryKernel::evaluateWith(Isa isa, const float* t, const float* C0, const float* S, const float* K, const float* V,
+                                    float* out, std::size_t n) {
+    if (!isaSupported(isa)) isa = Isa::Scalar;
+#ifdef IAPS_KERNEL_X86
+    if (isa == Isa::AVX2) { evaluateAvx2(t, C0, S, K, V, out, n); return; }
+    if (isa == Isa::SSE2) { evaluateSse2(t, C0, S, K, V, out, n); return; }
+#endif
+    evaluateScalar(t, C0, S, K, V, out, n);
+}
+
+void TrajectoryKernel::evaluate(const float* t, const float* C0, const float* S, const float* K, const float* V,
+                                float* out, std::size_t n) {
+    evaluateWith(activeIsa(), t, C0, S, K, V, out, n);
+}
+
+// 단일 시나리오 궤적: S/(kV)와 진폭은 한 번만 계산하고 시간 배열만 벡터화
+void TrajectoryKernel::evaluateTrajectory(const ModelParams& params, const float* t, float* out, std::size_t n) {
+    float css = ConcentrationModel::steadyState(params);
+    float amplitude = params.C0 - css;
+#ifdef IAPS_KERNEL_X86
+    Isa isa = activeIsa();
+    if (isa == Isa::AVX2) { trajectoryAvx2(amplitude, css, params.K, t, out, n); return; }
+    if (isa == Isa::SSE2) { trajectorySse2(amplitude, css, params.K, t, out, n); return; }
+#endif
+    trajectoryScalar(amplitude, css, params.K, t, out, n);
+}
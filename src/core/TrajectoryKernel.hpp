@@ -0,0 +1,43 @@
+#ifndef TRAJECTORY_KERNEL_HPP
+#define TRAJECTORY_KERNEL_HPP
+
+#include <cstddef>
+#include "Model.hpp"
+
+// C(t) = (C0 - S/(kV)) * exp(-kt) + S/(kV) 를 대량의 배열에 대해 한 번에 계산하는 벡터화 커널
+// x86에서는 실행 시점에 AVX2(+FMA) / SSE2 경로를 선택하고, 그 외에는 스칼라 경로를 사용
+// 모든 경로는 동일한 다항식 근사 exp를 사용하며, exp의 최대 상대 오차는 약 2e-7 (2 ulp 이내)
+class TrajectoryKernel {
+public:
+    // 커널 구현 종류
+    enum class Isa {
+        Scalar, // 이식 가능한 스칼라 구현
+        SSE2,   // 128비트 (float 4개)
+        AVX2    // 256비트 (float 8개, FMA 사용)
+    };
+
+    // 현재 CPU에서 선택된 구현
+    static Isa activeIsa();
+    // 해당 구현을 현재 CPU에서 사용할 수 있는지 여부
+    static bool isaSupported(Isa isa);
+    // 구현 이름 문자열
+    static const char* isaName(Isa isa);
+
+    // 구조체 배열(SoA) 입력: 원소 i마다 (t, C0, S, K, V)로 C(t) 계산 (음수는 0으로 보정)
+    static void evaluate(const float* t, const float* C0, const float* S, const float* K, const float* V,
+                         float* out, std::size_t n);
+    // 단일 시나리오의 여러 시간 t[i]에 대한 궤적 계산
+    static void evaluateTrajectory(const ModelParams& params, const float* t, float* out, std::size_t n);
+
+    // 지정한 구현으로 강제 실행 (검증 및 벤치마크용, 지원되지 않는 구현이면 스칼라 사용)
+    static void evaluateWith(Isa isa, const float* t, const float* C0, const float* S, const float* K, const float* V,
+                             float* out, std::size_t n);
+
+    // 스칼라 근사 exp (벡터 경로와 동일한 다항식)
+    static float fastExp(float x);
+
+    // 근사 exp의 허용 상대 오차 (정확도 검증 기준)
+    static const float EXP_REL_ERROR_BOUND;
+};
+
+#endif
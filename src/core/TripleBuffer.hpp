@@ -0,0 +1,46 @@
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+
+#include <atomic>
+
+// 생산자 스레드 하나와 소비자 스레드 하나 사이의 잠금 없는(lock-free) 삼중 버퍼
+// 생산자는 뒤 버퍼에 쓰고 publish()로 가운데 버퍼와 교환, 소비자는 update()로 새 가운데 버퍼를 앞 버퍼와 교환함
+// 교환은 원자적 exchange 한 번이라 어느 쪽도 기다리지 않으며, 소비자는 항상 가장 최근에 완성된 값을 읽음
+// (생산자가 더 빠르면 중간 값은 덮어써져 건너뜀)
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : m_middle(1), m_back(0), m_front(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // 생산자: 다음에 채울 버퍼 (이전 내용이 남아 있으므로 필요한 부분만 덮어쓰면 됨)
+    T& writeBuffer() { return m_buffers[m_back]; }
+    // 생산자: 채운 버퍼를 소비자에게 넘김
+    void publish() {
+        unsigned previous = m_middle.exchange(m_back | FRESH, std::memory_order_acq_rel);
+        m_back = previous & INDEX_MASK;
+    }
+
+    // 소비자: 새로 넘어온 버퍼가 있으면 앞 버퍼로 가져오고 true
+    bool update() {
+        if ((m_middle.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+        unsigned previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & INDEX_MASK;
+        return true;
+    }
+    // 소비자: 가장 최근에 가져온 버퍼
+    const T& readBuffer() const { return m_buffers[m_front]; }
+
+private:
+    static const unsigned INDEX_MASK = 3u; // 버퍼 인덱스 (0 ~ 2)
+    static const unsigned FRESH = 4u;      // 가운데 버퍼에 소비자가 아직 읽지 않은 값이 있음
+
+    T m_buffers[3];
+    std::atomic<unsigned> m_middle; // 가운데 버퍼 인덱스 | FRESH (두 스레드가 교환)
+    unsigned m_back;                // 생산자 전용
+    unsigned m_front;               // 소비자 전용
+};
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef UNINITIALIZED_ALLOCATOR_HPP
+#define UNINITIALIZED_ALLOCATOR_HPP
+
+#include <memory>
+#include <new>
+#include <utility>
+
+// resize() 시 원소를 값 초기화(0으로 채우기)하지 않는 할당자
+// 큰 배열을 할당만 해 두고 실제로 처음 쓰는 스레드가 페이지를 건드리게 해
+// NUMA 시스템에서 첫 접근(first-touch) 정책으로 페이지가 그 스레드의 메모리 노드에 놓이도록 함
+template <typename T>
+struct UninitializedAllocator : std::allocator<T> {
+    template <typename U> struct rebind { using other = UninitializedAllocator<U>; };
+
+    UninitializedAllocator() noexcept = default;
+    template <typename U> UninitializedAllocator(const UninitializedAllocator<U>&) noexcept {}
+
+    // 인자 없는 생성은 기본 초기화 (trivial 타입이면 아무것도 쓰지 않음)
+    template <typename U> void construct(U* p) noexcept { ::new (static_cast<void*>(p)) U; }
+    template <typename U, typename... Args> void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
+#endif
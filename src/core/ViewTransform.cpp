@@ -0,0 +1,125 @@
+#include "ViewTransform.hpp"
+#include <cmath>
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IAPS_VIEW_X86 1 // GCC/Clang x86: target 속성으로 ISA별 함수를 한 파일에 컴파일
+#include <immintrin.h>
+#endif
+
+const float ViewTransform::VIEW_EXTENT = 350.f;
+const float ViewTransform::PERSPECTIVE_DISTANCE = 500.f;
+const float ViewTransform::MIN_ROOM_DIMENSION = 0.01f;
+
+// 반올림 전 화면 좌표 제한 (시점 바로 앞 점의 원근 계수가 발산해도 정수 변환이 넘치지 않도록)
+static const float SCREEN_LIMIT = 1e6f;
+
+ViewTransform::ViewTransform() : m_matrix{1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f}, m_centerX(0.f), m_centerY(0.f) {}
+
+// Y축 회전 후 X축 회전 (SettingScreen/SimulationScreen의 기존 변환 순서와 동일)
+void ViewTransform::update(float rotationX, float rotationY, float width, float depth, float height, float centerX, float centerY) {
+    float w = std::max(width, MIN_ROOM_DIMENSION), d = std::max(depth, MIN_ROOM_DIMENSION), h = std::max(height, MIN_ROOM_DIMENSION);
+    float scale = VIEW_EXTENT / std::max({w, d, h, 1.f});
+    float cx = std::cos(rotationX), sx = std::sin(rotationX), cy = std::cos(rotationY), sy = std::sin(rotationY);
+    const float matrix[9] = {
+        scale * w * cy,       0.f,            -scale * d * sy,
+        -scale * w * sy * sx, scale * h * cx, -scale * d * cy * sx,
+        scale * w * sy * cx,  scale * h * sx, scale * d * cy * cx,
+    };
+    std::copy(matrix, matrix + 9, m_matrix);
+    m_centerX = centerX;
+    m_centerY = centerY;
+}
+
+Vec3D ViewTransform::transform(const Vec3D& local) const {
+    const float* m = m_matrix;
+    return {m[0] * local.x + m[1] * local.y + m[2] * local.z,
+            m[3] * local.x + m[4] * local.y + m[5] * local.z,
+            m[6] * local.x + m[7] * local.y + m[8] * local.z};
+}
+
+// --- 스칼라 구현 (SIMD 경로의 나머지 원소 및 x86 이외 플랫폼) ---
+// 반올림은 SIMD 경로와 같은 가장 가까운 짝수 방식
+static void projectScalar(const float* m, float centerX, float centerY, const float* x, const float* y, const float* z,
+                          float* screenX, float* screenY, float* perspective, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        float tx = m[0] * x[i] + m[1] * y[i] + m[2] * z[i];
+        float ty = m[3] * x[i] + m[4] * y[i] + m[5] * z[i];
+        float tz = m[6] * x[i] + m[7] * y[i] + m[8] * z[i];
+        float p = ViewTransform::PERSPECTIVE_DISTANCE / (ViewTransform::PERSPECTIVE_DISTANCE + tz);
+        screenX[i] = std::nearbyint(std::clamp(tx * p + centerX, -SCREEN_LIMIT, SCREEN_LIMIT));
+        screenY[i] = std::nearbyint(std::clamp(ty * p + centerY, -SCREEN_LIMIT, SCREEN_LIMIT));
+        if (perspective) perspective[i] = p;
+    }
+}
+
+#ifdef IAPS_VIEW_X86
+// --- SSE2 구현 (4개씩) ---
+__attribute__((target("sse2")))
+static void projectSse2(const float* m, float centerX, float centerY, const float* x, const float* y, const float* z,
+                        float* screenX, float* screenY, float* perspective, std::size_t n) {
+    const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]), m2 = _mm_set1_ps(m[2]);
+    const __m128 m3 = _mm_set1_ps(m[3]), m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]);
+    const __m128 m6 = _mm_set1_ps(m[6]), m7 = _mm_set1_ps(m[7]), m8 = _mm_set1_ps(m[8]);
+    const __m128 dist = _mm_set1_ps(ViewTransform::PERSPECTIVE_DISTANCE);
+    const __m128 lo = _mm_set1_ps(-SCREEN_LIMIT), hi = _mm_set1_ps(SCREEN_LIMIT);
+    const __m128 cx = _mm_set1_ps(centerX), cy = _mm_set1_ps(centerY);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+        __m128 tx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, vx), _mm_mul_ps(m1, vy)), _mm_mul_ps(m2, vz));
+        __m128 ty = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m3, vx), _mm_mul_ps(m4, vy)), _mm_mul_ps(m5, vz));
+        __m128 tz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m6, vx), _mm_mul_ps(m7, vy)), _mm_mul_ps(m8, vz));
+        __m128 p = _mm_div_ps(dist, _mm_add_ps(dist, tz));
+        __m128 sx = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(tx, p), cx), lo), hi);
+        __m128 sy = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(ty, p), cy), lo), hi);
+        // cvtps_epi32는 기본 반올림 모드(가장 가까운 짝수)로 정수 변환
+        _mm_storeu_ps(screenX + i, _mm_cvtepi32_ps(_mm_cvtps_epi32(sx)));
+        _mm_storeu_ps(screenY + i, _mm_cvtepi32_ps(_mm_cvtps_epi32(sy)));
+        if (perspective) _mm_storeu_ps(perspective + i, p);
+    }
+    projectScalar(m, centerX, centerY, x + i, y + i, z + i, screenX + i, screenY + i, perspective ? perspective + i : nullptr, n - i);
+}
+
+// --- AVX2 구현 (8개씩, FMA 사용) ---
+__attribute__((target("avx2,fma")))
+static void projectAvx2(const float* m, float centerX, float centerY, const float* x, const float* y, const float* z,
+                        float* screenX, float* screenY, float* perspective, std::size_t n) {
+    const __m256 m0 = _mm256_set1_ps(m[0]), m1 = _mm256_set1_ps(m[1]), m2 = _mm256_set1_ps(m[2]);
+    const __m256 m3 = _mm256_set1_ps(m[3]), m4 = _mm256_set1_ps(m[4]), m5 = _mm256_set1_ps(m[5]);
+    const __m256 m6 = _mm256_set1_ps(m[6]), m7 = _mm256_set1_ps(m[7]), m8 = _mm256_set1_ps(m[8]);
+    const __m256 dist = _mm256_set1_ps(ViewTransform::PERSPECTIVE_DISTANCE);
+    const __m256 lo = _mm256_set1_ps(-SCREEN_LIMIT), hi = _mm256_set1_ps(SCREEN_LIMIT);
+    const __m256 cx = _mm256_set1_ps(centerX), cy = _mm256_set1_ps(centerY);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+        __m256 tx = _mm256_fmadd_ps(m2, vz, _mm256_fmadd_ps(m1, vy, _mm256_mul_ps(m0, vx)));
+        __m256 ty = _mm256_fmadd_ps(m5, vz, _mm256_fmadd_ps(m4, vy, _mm256_mul_ps(m3, vx)));
+        __m256 tz = _mm256_fmadd_ps(m8, vz, _mm256_fmadd_ps(m7, vy, _mm256_mul_ps(m6, vx)));
+        __m256 p = _mm256_div_ps(dist, _mm256_add_ps(dist, tz));
+        __m256 sx = _mm256_min_ps(_mm256_max_ps(_mm256_fmadd_ps(tx, p, cx), lo), hi);
+        __m256 sy = _mm256_min_ps(_mm256_max_ps(_mm256_fmadd_ps(ty, p, cy), lo), hi);
+        _mm256_storeu_ps(screenX + i, _mm256_round_ps(sx, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        _mm256_storeu_ps(screenY + i, _mm256_round_ps(sy, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        if (perspective) _mm256_storeu_ps(perspective + i, p);
+    }
+    projectScalar(m, centerX, centerY, x + i, y + i, z + i, screenX + i, screenY + i, perspective ? perspective + i : nullptr, n - i);
+}
+#endif
+
+void ViewTransform::project(const Vec3D& local, float& screenX, float& screenY, float& perspective) const {
+    projectScalar(m_matrix, m_centerX, m_centerY, &local.x, &local.y, &local.z, &screenX, &screenY, &perspective, 1);
+}
+
+// 가장 넓은 지원 경로 선택 (최초 호출 시 한 번만 판정)
+void ViewTransform::projectBatch(const float* x, const float* y, const float* z,
+                                 float* screenX, float* screenY, float* perspective, std::size_t n) const {
+#ifdef IAPS_VIEW_X86
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (hasAvx2) { projectAvx2(m_matrix, m_centerX, m_centerY, x, y, z, screenX, screenY, perspective, n); return; }
+    projectSse2(m_matrix, m_centerX, m_centerY, x, y, z, screenX, screenY, perspective, n);
+#else
+    projectScalar(m_matrix, m_centerX, m_centerY, x, y, z, screenX, screenY, perspective, n);
+#endif
+}
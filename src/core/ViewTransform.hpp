@@ -0,0 +1,36 @@
+#ifndef VIEW_TRANSFORM_HPP
+#define VIEW_TRANSFORM_HPP
+
+#include <cstddef>
+#include "Geometry.hpp"
+
+// 3D 뷰의 정규화 로컬 좌표(-0.5 ~ 0.5) → 화면 좌표 변환
+// 방 크기 스케일, Y축 회전, X축 회전, 뷰 스케일(VIEW_EXTENT / 최대 차원)을 3×3 행렬 하나로 합쳐 두고
+// (cos/sin은 회전각이나 방 크기가 바뀔 때 update()에서 한 번만 계산)
+// 원근 투영 p = PERSPECTIVE_DISTANCE / (PERSPECTIVE_DISTANCE + z) 후 화면 중심을 더해 가장 가까운 픽셀로 반올림
+// 일괄 투영은 x86에서 실행 시점에 AVX2(8개씩) / SSE2(4개씩) 경로를 선택함
+class ViewTransform {
+public:
+    ViewTransform();
+
+    // 회전각(라디안), 방 크기(m), 화면 중심 좌표로 변환 행렬 갱신
+    void update(float rotationX, float rotationY, float width, float depth, float height, float centerX, float centerY);
+
+    // 로컬 좌표 → 회전·스케일 적용 좌표 (투영 전, z는 깊이)
+    Vec3D transform(const Vec3D& local) const;
+    // 로컬 좌표 한 점 투영: 화면 좌표와 원근 계수
+    void project(const Vec3D& local, float& screenX, float& screenY, float& perspective) const;
+    // 배열 구조(SoA) 로컬 좌표 n개를 한 번에 투영 (perspective가 nullptr이면 원근 계수는 저장하지 않음)
+    void projectBatch(const float* x, const float* y, const float* z,
+                      float* screenX, float* screenY, float* perspective, std::size_t n) const;
+
+    static const float VIEW_EXTENT;          // 방의 가장 긴 축이 차지하는 뷰 크기 (픽셀)
+    static const float PERSPECTIVE_DISTANCE; // 원근 투영 시점 거리 (픽셀)
+    static const float MIN_ROOM_DIMENSION;   // 0으로 나누기를 막기 위한 최소 방 크기 (m)
+
+private:
+    float m_matrix[9];         // 로컬 → 회전·스케일 좌표 행렬 (행 우선)
+    float m_centerX, m_centerY; // 화면 중심
+};
+
+#endif
@@ -0,0 +1,217 @@
+#include "ZoneNetwork.hpp"
+#include "DenseEigen.hpp"
+#include "Model.hpp"
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+// 통로 개구부의 평균 교환 풍속 (약 0.1 m/s)
+const double ZoneNetwork::PASSAGE_AIR_VELOCITY = 6.0;
+// SettingScreen의 PASSAGE_RELATIVE_*_FACTOR와 동일한 기본 통로 크기 비율
+const float ZoneNetwork::DEFAULT_PASSAGE_WIDTH_FACTOR = 0.25f;
+const float ZoneNetwork::DEFAULT_PASSAGE_HEIGHT_FACTOR = 0.7f;
+
+ZoneNetwork::ZoneNetwork() : m_solved(false) {}
+
+std::size_t ZoneNetwork::addZone(double volume, double S, double K, double C0) {
+    if (volume < ConcentrationModel::MIN_VOLUME) volume = ConcentrationModel::MIN_VOLUME; // 부피 최소값 보장
+    if (K < ConcentrationModel::MIN_K) K = ConcentrationModel::MIN_K; // 음정부호 보장을 위한 K 최소값
+    m_zones.push_back({volume, S, K, C0});
+    m_solved = false;
+    return m_zones.size() - 1;
+}
+
+bool ZoneNetwork::addConnection(std::size_t a, std::size_t b, double flow) {
+    if (a >= m_zones.size() || b >= m_zones.size() || a == b || !std::isfinite(flow) || flow < 0.0) return false; // 잘못된 연결
+    m_connections.push_back({a, b, flow});
+    m_solved = false;
+    return true;
+}
+
+std::size_t ZoneNetwork::size() const { return m_zones.size(); }
+
+const std::vector<ZoneNetwork::Zone>& ZoneNetwork::zones() const { return m_zones; }
+
+const std::vector<ZoneNetwork::Connection>& ZoneNetwork::connections() const { return m_connections; }
+
+const std::vector<double>& ZoneNetwork::steadyState() const { return m_steadyState; }
+
+// 시스템 행렬 구성 및 고유값 분해
+bool ZoneNetwork::solve() {
+    std::size_t n = m_zones.size();
+    m_solved = false;
+    if (n == 0) return false;
+
+    // 대칭화된 행렬 B = D A D⁻¹ (B_ij = Q_ij / √(V_i V_j), B_ii = A_ii)
+    m_sqrtVolume.resize(n);
+    for (std::size_t i = 0; i < n; ++i) m_sqrtVolume[i] = std::sqrt(m_zones[i].volume);
+    std::vector<double> B(n * n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) B[i * n + i] = -m_zones[i].K;
+    for (const Connection& c : m_connections) {
+        double offDiag = c.flow / (m_sqrtVolume[c.a] * m_sqrtVolume[c.b]);
+        B[c.a * n + c.b] += offDiag;
+        B[c.b * n + c.a] += offDiag;
+        B[c.a * n + c.a] -= c.flow / m_zones[c.a].volume; // 유출
+        B[c.b * n + c.b] -= c.flow / m_zones[c.b].volume;
+    }
+
+    if (!symmetricEigen(n, B, m_eigenvalues, m_eigenvectors)) {
+        std::cerr << "Warning: Zone network eigen-decomposition did not fully converge." << std::endl;
+    }
+
+    // 정상 상태: Css = -A⁻¹ b = -D⁻¹ Q Λ⁻¹ Qᵀ D b
+    std::vector<double> modal(n, 0.0);
+    for (std::size_t j = 0; j < n; ++j) {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < n; ++i) sum += m_eigenvectors[i * n + j] * m_sqrtVolume[i] * (m_zones[i].S / m_zones[i].volume);
+        modal[j] = -sum / m_eigenvalues[j]; // K > 0 이므로 고유값은 음수 (0 아님)
+    }
+    m_steadyState.assign(n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < n; ++j) sum += m_eigenvectors[i * n + j] * modal[j];
+        m_steadyState[i] = sum / m_sqrtVolume[i];
+    }
+
+    // 초기 편차의 고유 좌표: y = Qᵀ D (C0 - Css)
+    m_modalInitial.assign(n, 0.0);
+    for (std::size_t j = 0; j < n; ++j) {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < n; ++i) sum += m_eigenvectors[i * n + j] * m_sqrtVolume[i] * (m_zones[i].C0 - m_steadyState[i]);
+        m_modalInitial[j] = sum;
+    }
+    m_solved = true;
+    return true;
+}
+
+// 시간 t에서의 농도: C(t) = Css + D⁻¹ Q (e^{Λt} ⊙ y)
+void ZoneNetwork::concentrationsAt(double t, std::vector<double>& out) const {
+    std::size_t n = m_zones.size();
+    out.assign(n, 0.0);
+    if (!m_solved) return;
+    std::vector<double> decayed(n);
+    for (std::size_t j = 0; j < n; ++j) decayed[j] = std::exp(m_eigenvalues[j] * t) * m_modalInitial[j];
+    for (std::size_t i = 0; i < n; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < n; ++j) sum += m_eigenvectors[i * n + j] * decayed[j];
+        double c = m_steadyState[i] + sum / m_sqrtVolume[i];
+        out[i] = (c < 0.0) ? 0.0 : c; // 농도는 음수가 될 수 없음
+    }
+}
+
+// 개구부 면적 × 교환 풍속
+double ZoneNetwork::passageFlow(const std::array<Vec3D, 4>& localCoords, float width, float depth, float height) {
+    // 로컬 정규화 좌표를 실제 크기로 변환 (x: 너비, y: 높이, z: 깊이)
+    std::array<Vec3D, 4> p;
+    for (std::size_t i = 0; i < 4; ++i) {
+        p[i] = {localCoords[i].x * width, localCoords[i].y * height, localCoords[i].z * depth};
+    }
+    // 사각형 면적 = |대각선1 × 대각선2| / 2
+    Vec3D d1 = {p[2].x - p[0].x, p[2].y - p[0].y, p[2].z - p[0].z};
+    Vec3D d2 = {p[3].x - p[1].x, p[3].y - p[1].y, p[3].z - p[1].z};
+    double cx = static_cast<double>(d1.y) * d2.z - static_cast<double>(d1.z) * d2.y;
+    double cy = static_cast<double>(d1.z) * d2.x - static_cast<double>(d1.x) * d2.z;
+    double cz = static_cast<double>(d1.x) * d2.y - static_cast<double>(d1.y) * d2.x;
+    double area = 0.5 * std::sqrt(cx * cx + cy * cy + cz * cz);
+    return area * PASSAGE_AIR_VELOCITY;
+}
+
+bool ZoneNetwork::validRoom(const FloorplanRoom& room) {
+    auto positive = [](float v) { return std::isfinite(v) && v > 0.f; };
+    return room.pollutantIndex >= 0 && room.pollutantIndex <= 2 && room.numWindows >= 0 &&
+           positive(room.width) && positive(room.depth) && positive(room.height) && std::isfinite(room.C0) && room.C0 >= 0.f;
+}
+
+// 구역 네트워크 텍스트 파일 읽기
+// zone,width,depth,height,pollutant,windows,c0  : 구역 (S, K는 오염물질/창문 기본값, 통로 효과는 연결로 대체)
+// link,a,b,area                                 : 구역 a, b를 면적 area(m²)의 개구부로 연결
+// passage,a,b                                   : 구역 a 앞면 중앙의 기본 통로로 연결
+// '#'으로 시작하는 줄은 주석
+// 연결은 앞에서 정의한 구역만 가리킬 수 있고, 잘못된 줄은 경고 후 건너뜀
+bool ZoneNetwork::readTextFile(const std::string& filename, std::vector<FloorplanRoom>& rooms, std::vector<FloorplanOpening>& openings) {
+    std::ifstream inFile(filename);
+    if (!inFile.is_open()) {
+        std::cerr << "Error: Could not open zone network file: " << filename << std::endl;
+        return false;
+    }
+    auto validLink = [&](std::size_t a, std::size_t b, double flow) { return a < rooms.size() && b < rooms.size() && a != b && std::isfinite(flow) && flow >= 0.0; };
+    std::string line; int lineNo = 0;
+    while (std::getline(inFile, line)) {
+        ++lineNo;
+        if (line.empty() || line[0] == '#') continue;
+        std::stringstream ss(line);
+        std::vector<std::string> f; std::string field;
+        while (std::getline(ss, field, ',')) f.push_back(field);
+        try {
+            if (f[0] == "zone" && f.size() == 7) {
+                int pollutant = std::stoi(f[4]), windows = std::stoi(f[5]);
+                if (pollutant < 0 || pollutant > 2) { std::cerr << "Warning: Invalid pollutant on line " << lineNo << ": " << line << std::endl; continue; }
+                if (windows < 0) { std::cerr << "Warning: Invalid windows on line " << lineNo << ": " << line << std::endl; continue; }
+                FloorplanRoom room{std::stof(f[1]), std::stof(f[2]), std::stof(f[3]), std::stof(f[6]), pollutant, windows};
+                if (!validRoom(room)) { std::cerr << "Warning: Invalid zone size or C0 on line " << lineNo << ": " << line << std::endl; continue; }
+                rooms.push_back(room);
+            } else if (f[0] == "link" && f.size() == 4) {
+                std::size_t a = std::stoul(f[1]), b = std::stoul(f[2]);
+                double flow = std::stod(f[3]) * PASSAGE_AIR_VELOCITY;
+                if (!validLink(a, b, flow)) { std::cerr << "Warning: Invalid link on line " << lineNo << ": " << line << std::endl; continue; }
+                openings.push_back({static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(b), flow});
+            } else if (f[0] == "passage" && f.size() == 3) {
+                std::size_t a = std::stoul(f[1]), b = std::stoul(f[2]);
+                if (!validLink(a, b, 0.0)) { std::cerr << "Warning: Invalid passage on line " << lineNo << ": " << line << std::endl; continue; }
+                float pw = DEFAULT_PASSAGE_WIDTH_FACTOR * 0.5f, ph = DEFAULT_PASSAGE_HEIGHT_FACTOR * 0.5f;
+                std::array<Vec3D, 4> door = {{{-pw, -ph, -0.5f}, {pw, -ph, -0.5f}, {pw, ph, -0.5f}, {-pw, ph, -0.5f}}};
+                openings.push_back({static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(b),
+                                    passageFlow(door, rooms[a].width, rooms[a].depth, rooms[a].height)});
+            } else {
+                std::cerr << "Warning: Skipping unknown line " << lineNo << ": " << line << std::endl;
+            }
+        } catch (const std::exception& e) { // stof/stoi 변환 실패
+            std::cerr << "Warning: Invalid value on line " << lineNo << ": " << line << " (" << e.what() << ")" << std::endl;
+        }
+    }
+    return true;
+}
+
+// 방마다 구역 하나, 개구부마다 연결 하나 추가 (인덱스는 이번에 추가한 방 기준)
+// 매핑한 바이너리 파일의 레코드는 여기서 처음 검사하므로, 방은 건너뛰면 개구부 인덱스가 어긋나 전체를 거부
+bool ZoneNetwork::addFloorplan(const FloorplanRoom* rooms, std::size_t roomCount, const FloorplanOpening* openings, std::size_t openingCount) {
+    for (std::size_t i = 0; i < roomCount; ++i) {
+        const FloorplanRoom& r = rooms[i];
+        if (!validRoom(r)) {
+            std::cerr << "Error: Invalid room " << i << " (size " << r.width << " x " << r.depth << " x " << r.height
+                      << ", pollutant " << r.pollutantIndex << ", windows " << r.numWindows << ", C0 " << r.C0 << ")" << std::endl;
+            return false;
+        }
+    }
+    const std::size_t base = m_zones.size();
+    m_zones.reserve(base + roomCount);
+    m_connections.reserve(m_connections.size() + openingCount);
+    for (std::size_t i = 0; i < roomCount; ++i) {
+        const FloorplanRoom& r = rooms[i];
+        RoomConfig room{r.width, r.depth, r.height, r.pollutantIndex, 0, r.numWindows};
+        float S = 0.f, K = 0.f;
+        ConcentrationModel::defaultSK(room.pollutantIndex, 0, room.numWindows, S, K);
+        addZone(ConcentrationModel::roomVolume(room), S, K, r.C0);
+    }
+    for (std::size_t i = 0; i < openingCount; ++i) {
+        const FloorplanOpening& o = openings[i];
+        if (o.a >= roomCount || o.b >= roomCount || !addConnection(base + o.a, base + o.b, o.flow)) {
+            std::cerr << "Warning: Skipping invalid opening " << i << " (" << o.a << " - " << o.b << ")" << std::endl;
+        }
+    }
+    return roomCount > 0;
+}
+
+// 식별자로 바이너리 평면도와 텍스트 파일 구분
+bool ZoneNetwork::loadFromFile(const std::string& filename) {
+    if (FloorplanFile::isFloorplanFile(filename)) {
+        FloorplanFile file;
+        if (!file.open(filename)) return false;
+        return addFloorplan(file.rooms(), file.roomCount(), file.openings(), file.openingCount());
+    }
+    std::vector<FloorplanRoom> rooms;
+    std::vector<FloorplanOpening> openings;
+    if (!readTextFile(filename, rooms, openings)) return false;
+    return addFloorplan(rooms.data(), rooms.size(), openings.data(), openings.size());
+}
@@ -0,0 +1,77 @@
+#ifndef ZONE_NETWORK_HPP
+#define ZONE_NETWORK_HPP
+
+#include <vector>
+#include <array>
+#include <string>
+#include <cstddef>
+#include "Geometry.hpp"
+#include "FloorplanFile.hpp"
+
+// 통로로 연결된 여러 방(구역)의 농도를 함께 푸는 다중 구역 모델
+// 구역 i의 질량 수지: V_i dC_i/dt = S_i - k_i V_i C_i + Σ_j Q_ij (C_j - C_i)
+// 즉 dC/dt = A·C + b (A_ii = -k_i - Σ_j Q_ij / V_i, A_ij = Q_ij / V_i, b_i = S_i / V_i)
+// 연결 풍량 Q_ij가 대칭이므로 D = diag(√V)로 A를 대칭 행렬로 바꿔 고유값 분해하고,
+// C(t) = Css + D⁻¹ Q e^{Λt} Qᵀ D (C0 - Css) 로 임의의 t를 O(N²)에 계산
+// (고유값 분해의 수치 안정성을 위해 내부 계산은 double 사용)
+class ZoneNetwork {
+public:
+    ZoneNetwork();
+
+    // 구역 추가 (부피 m³, 유입 속도 S, 제거 상수 K, 초기 농도 C0), 구역 인덱스 반환
+    std::size_t addZone(double volume, double S, double K, double C0);
+    // 두 구역을 풍량 flow(m³/min)로 양방향 연결 (같은 쌍을 여러 번 연결하면 풍량이 더해짐)
+    bool addConnection(std::size_t a, std::size_t b, double flow);
+    // 구역 수
+    std::size_t size() const;
+
+    // 시스템 행렬 구성 및 고유값 분해 (구역/연결 변경 후 반드시 호출, 실패 시 false)
+    bool solve();
+    // 시간 t(분)에서의 모든 구역 농도 (solve() 이후 호출, O(N²))
+    void concentrationsAt(double t, std::vector<double>& out) const;
+    // 정상 상태 농도 -A⁻¹b
+    const std::vector<double>& steadyState() const;
+
+    // 파일에서 구역과 연결 읽기 (바이너리 평면도 또는 텍스트 형식, 실패 시 false)
+    bool loadFromFile(const std::string& filename);
+    // 평면도의 방/개구부 배열을 구역/연결로 추가 (방이 없거나 validRoom()을 통과하지 못한 방이 있으면 아무것도 추가하지 않고 false,
+    // 잘못된 개구부는 경고 후 건너뜀)
+    bool addFloorplan(const FloorplanRoom* rooms, std::size_t roomCount, const FloorplanOpening* openings, std::size_t openingCount);
+    // 텍스트 형식(형식은 .cpp 참고)을 평면도 배열로 읽기 (바이너리 변환용, 파일을 열 수 없으면 false)
+    static bool readTextFile(const std::string& filename, std::vector<FloorplanRoom>& rooms, std::vector<FloorplanOpening>& openings);
+
+    // 방 레코드 값 검사: 오염물질 0 ~ 2, 창문 0개 이상, 크기는 유한한 양수, C0는 유한한 0 이상 (텍스트와 바이너리 공통)
+    static bool validRoom(const FloorplanRoom& room);
+
+    // 개구부 4개 정점(정규화 로컬 좌표)과 방 크기로 계산한 통로 교환 풍량 (면적 × 교환 풍속)
+    static double passageFlow(const std::array<Vec3D, 4>& localCoords, float width, float depth, float height);
+
+    static const double PASSAGE_AIR_VELOCITY;         // 통로 개구부 평균 교환 풍속 (m/min)
+    static const float DEFAULT_PASSAGE_WIDTH_FACTOR;  // 기본 통로 너비 비율 (SettingScreen과 동일)
+    static const float DEFAULT_PASSAGE_HEIGHT_FACTOR; // 기본 통로 높이 비율 (SettingScreen과 동일)
+
+    // 구역 정보
+    struct Zone {
+        double volume, S, K, C0;
+    };
+    // 두 구역 사이 연결
+    struct Connection {
+        std::size_t a, b;
+        double flow;
+    };
+    // 구역 및 연결 목록 (희소 해석기 등 다른 해석기가 같은 모델 설명을 공유)
+    const std::vector<Zone>& zones() const;
+    const std::vector<Connection>& connections() const;
+
+private:
+    std::vector<Zone> m_zones;             // 구역 목록
+    std::vector<Connection> m_connections; // 연결 목록
+    std::vector<double> m_sqrtVolume;      // √V_i (대칭화 계수)
+    std::vector<double> m_eigenvalues;     // 대칭화 행렬의 고유값 (모두 음수)
+    std::vector<double> m_eigenvectors;    // 고유벡터 (N x N 행 우선, 열이 고유벡터)
+    std::vector<double> m_steadyState;     // 정상 상태 농도
+    std::vector<double> m_modalInitial;    // Qᵀ D (C0 - Css): 초기 편차의 고유 좌표
+    bool m_solved;                         // solve() 성공 여부
+};
+
+#endif
@@ -2,12 +2,71 @@
 #include "setting/Setting.hpp"
 #include "screen/Screen.hpp"
 #include "simulation/Simulation.hpp"
+#include "screen/ProfilerOverlay.hpp"
+#include "core/Profiler.hpp"
 #include <iostream> 
+#include <algorithm>
+#include <string>
 
 const unsigned int WINDOW_WIDTH = 1366; // 창 너비 상수 정의
 const unsigned int WINDOW_HEIGHT = 768; // 창 높이 상수 정의
+const sf::Time IDLE_POLL_SLICE = sf::milliseconds(10); // 시간 제한 대기 중 이벤트 확인 간격
 
-int main() {
+// 이벤트가 올 때까지 대기 (timeout이 Zero가 아니면 최대 timeout까지만), 이벤트를 받았으면 true
+// SFML 2.6의 waitEvent에는 시간 제한이 없으므로 시간 제한 대기는 짧게 잠들며 이벤트를 확인
+static bool waitForEvent(sf::RenderWindow& window, sf::Event& event, sf::Time timeout) {
+    if (timeout == sf::Time::Zero) return window.waitEvent(event);
+    sf::Clock waitClock;
+    while (!window.pollEvent(event)) {
+        sf::Time remaining = timeout - waitClock.getElapsedTime();
+        if (remaining <= sf::Time::Zero) return false;
+        sf::sleep(std::min(remaining, IDLE_POLL_SLICE));
+    }
+    return true;
+}
+
+// 이벤트 하나 전달: 프로파일러 오버레이 단축키(F3, F4)가 아니면 화면으로, 오버레이가 처리했으면 true
+template <typename ScreenType>
+static bool dispatchEvent(ScreenType& screen, ProfilerOverlay& overlay, const sf::Event& event) {
+    if (overlay.handleEvent(event)) return true;
+    screen.handleEvent(event);
+    return false;
+}
+
+// 화면 한 프레임 실행 (필요할 때만 그리기)
+// 움직이는 요소가 있으면 매 프레임 갱신하고 그림 (프레임 제한으로 60 FPS 유지),
+// 없으면 이벤트(또는 화면이 요청한 시간)까지 잠들었다가 화면이 바뀐 경우에만 다시 그림
+// 단계마다(입력, 갱신, 그리기, 표시) 프로파일러 구간을 남기며, 분류는 화면 이름(profileCategory)
+template <typename ScreenType>
+static void runScreenFrame(sf::RenderWindow& window, ScreenType& screen, ProfilerOverlay& overlay, sf::Clock& deltaClock, const char* profileCategory) {
+    bool overlayChanged = false; // 오버레이를 켜고 끄면 화면이 그대로여도 다시 그림
+    if (!screen.isAnimating() && !screen.needsRedraw()) {
+        sf::Event event;
+        if (waitForEvent(window, event, screen.idleTimeout())) overlayChanged |= dispatchEvent(screen, overlay, event); // 대기 중 받은 이벤트 먼저 처리
+        deltaClock.restart(); // 잠들어 있던 시간은 프레임 간격에 넣지 않음
+    }
+    sf::Time dt = deltaClock.restart(); // 이전 프레임 이후 경과 시간
+    {
+        PROFILE_SCOPE(profileCategory, "handleInput");
+        sf::Event event;
+        while (window.pollEvent(event)) overlayChanged |= dispatchEvent(screen, overlay, event); // 남은 이벤트 처리
+    }
+    {
+        PROFILE_SCOPE(profileCategory, "update");
+        screen.update(dt); // 상태 업데이트
+    }
+    if (!screen.needsRedraw() && !overlayChanged) return; // 바뀐 것이 있을 때만 렌더링
+    {
+        PROFILE_SCOPE(profileCategory, "render");
+        screen.render();
+    }
+    PROFILE_SCOPE(profileCategory, "present");
+    overlay.draw(window); // 표시 중이면 화면 위에 프로파일러 오버레이
+    window.display();     // 그려진 내용 실제 화면에 표시 (프레임 제한 대기 포함)
+}
+
+// 사용법: iaps [--room 방모델.obj|.ply]  (--room: 설정 화면의 방을 다면체 모델로 시작)
+int main(int argc, char* argv[]) {
     // 렌더링 창 생성 (너비, 높이, 창 제목)
     sf::RenderWindow window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Indoor Air Pollution Simulator");
     // 초당 프레임 수 제한 설정 (60 FPS)
@@ -29,15 +88,23 @@ int main() {
     StartScreen startScreen(window, neoFont);           // 시작 화면 객체
     SettingScreen settingScreen(window, neoFont);       // 설정 화면 객체
     SimulationScreen simulationScreen(window, neoFont); // 시뮬레이션 화면 객체
+    ProfilerOverlay profilerOverlay(neoFont);           // 모든 화면 위에 겹치는 프로파일러 오버레이 (F3)
+
+    // 명령줄 인자 처리 (불러오기에 실패하면 오류만 출력하고 직육면체 방으로 시작)
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--room" && i + 1 < argc) {
+            settingScreen.importRoomMesh(argv[++i]);
+        } else {
+            std::cerr << "Warning: Ignoring unknown argument: " << arg << std::endl;
+        }
+    }
 
     // 시간 측정용 시계 객체 (델타 타임 계산용)
     sf::Clock deltaClock;
 
     // 메인 게임 루프: 창이 열려있는 동안 반복
     while (window.isOpen()) {
-        // 이전 프레임 이후 경과 시간 계산 및 시계 재시작
-        sf::Time dt = deltaClock.restart();
-
         // 현재 화면 상태에 따라 분기 처리
         if (currentScreenState == ScreenState::START) { // 현재 시작 화면일 경우
             // 시작 화면이 더 이상 실행 중이 아니면 (다음 화면으로 전환 요청 시)
@@ -51,9 +118,7 @@ int main() {
             }
             // 시작 화면이 여전히 현재 화면이면 (화면 전환이 아직 안 됐으면)
             if (currentScreenState == ScreenState::START) {
-                startScreen.handleInput(); // 시작 화면 입력 처리
-                startScreen.update(dt);    // 시작 화면 상태 업데이트
-                startScreen.render();      // 시작 화면 렌더링
+                runScreenFrame(window, startScreen, profilerOverlay, deltaClock, "start"); // 시작 화면 입력 처리, 업데이트, 렌더링
             }
         } else if (currentScreenState == ScreenState::SETTING) { // 현재 설정 화면일 경우
             // 설정 화면이 더 이상 실행 중이 아니면
@@ -63,16 +128,15 @@ int main() {
                     startScreen.reset(); // 시작 화면 상태 초기화
                 } else if (currentScreenState == ScreenState::SIMULATION) { // 다음 화면이 시뮬레이션 화면이면
                     std::cout << "Switching to SIMULATION screen" << std::endl; // 콘솔 메시지 출력
-                    simulationScreen.reset(); // 시뮬레이션 화면 상태 초기화
+                    simulationScreen.setScenario(settingScreen.scenario()); // 설정값을 파일 없이 그대로 전달
+                    simulationScreen.reset(); // 시뮬레이션 화면 상태 초기화 (전달받은 시나리오 반영)
                 } else if (currentScreenState == ScreenState::EXIT) { // 다음 화면이 종료면
                     window.close(); // 창 닫기
                 }
             }
             // 설정 화면이 여전히 현재 화면이면
             if (currentScreenState == ScreenState::SETTING) {
-                settingScreen.handleInput(); // 설정 화면 입력 처리
-                settingScreen.update(dt);    // 설정 화면 상태 업데이트
-                settingScreen.render();      // 설정 화면 렌더링
+                runScreenFrame(window, settingScreen, profilerOverlay, deltaClock, "setting"); // 설정 화면 입력 처리, 업데이트, 필요 시 렌더링
             }
         } else if (currentScreenState == ScreenState::SIMULATION) { // 현재 시뮬레이션 화면일 경우
             // 시뮬레이션 화면이 더 이상 실행 중이 아니면
@@ -86,9 +150,7 @@ int main() {
             }
             // 시뮬레이션 화면이 여전히 현재 화면이면
             if (currentScreenState == ScreenState::SIMULATION) {
-                simulationScreen.handleInput(); // 시뮬레이션 화면 입력 처리
-                simulationScreen.update(dt);    // 시뮬레이션 화면 상태 업데이트
-                simulationScreen.render();      // 시뮬레이션 화면 렌더링
+                runScreenFrame(window, simulationScreen, profilerOverlay, deltaClock, "simulation"); // 시뮬레이션 화면 입력 처리, 업데이트, 필요 시 렌더링
             }
         } else if (currentScreenState == ScreenState::EXIT) { // 현재 상태가 종료면
             window.close(); // 창 닫기
@@ -0,0 +1,109 @@
+#include "ProfilerOverlay.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+const char* const ProfilerOverlay::TRACE_FILE = "iaps_trace.json";
+const sf::Time ProfilerOverlay::REFRESH_INTERVAL = sf::milliseconds(250);
+const unsigned ProfilerOverlay::CHARACTER_SIZE = 14;
+const float ProfilerOverlay::ROW_HEIGHT = 18.f;
+const float ProfilerOverlay::BAR_WIDTH = 4.f;
+
+static const float PADDING = 8.f;       // 배경 안쪽 여백
+static const float TEXT_WIDTH = 330.f;  // 구간 이름과 백분위 글자 영역 너비
+
+ProfilerOverlay::ProfilerOverlay(sf::Font& font) : m_font(font), m_visible(false) {
+    m_text.setFont(m_font);
+    m_text.setCharacterSize(CHARACTER_SIZE);
+    m_text.setFillColor(sf::Color::White);
+    m_background.setFillColor(sf::Color(0, 0, 0, 190));
+    m_bars.setPrimitiveType(sf::Triangles);
+}
+
+bool ProfilerOverlay::handleEvent(const sf::Event& event) {
+    if (event.type != sf::Event::KeyPressed) return false;
+    if (event.key.code == sf::Keyboard::F3) {
+        m_visible = !m_visible;
+        updateEnabled();
+        m_refreshClock.restart();
+        m_stats = Profiler::instance().stats();
+        return true;
+    }
+    if (event.key.code == sf::Keyboard::F4) {
+        toggleCapture();
+        return true;
+    }
+    return false;
+}
+
+bool ProfilerOverlay::visible() const { return m_visible; }
+
+void ProfilerOverlay::updateEnabled() {
+    Profiler::instance().setEnabled(m_visible || Profiler::instance().capturing());
+}
+
+// 캡처 종료 시 파일로 저장하고 결과를 콘솔에 출력
+void ProfilerOverlay::toggleCapture() {
+    Profiler& profiler = Profiler::instance();
+    if (!profiler.capturing()) {
+        profiler.beginCapture();
+        std::cout << "Profiler: trace capture started" << std::endl;
+    } else {
+        profiler.endCapture();
+        if (profiler.writeChromeTrace(TRACE_FILE)) {
+            std::cout << "Profiler: wrote " << profiler.capturedEvents() << " events to " << TRACE_FILE << std::endl;
+        }
+    }
+    updateEnabled();
+}
+
+// 줄마다 "분류/구간  p50  p99" 텍스트와 오른쪽에 분포 막대 (가장 많은 구간이 한 줄 높이)
+void ProfilerOverlay::draw(sf::RenderWindow& window) {
+    if (!m_visible) return;
+    if (m_refreshClock.getElapsedTime() >= REFRESH_INTERVAL) {
+        m_refreshClock.restart();
+        m_stats = Profiler::instance().stats();
+    }
+
+    const float barsWidth = BAR_WIDTH * static_cast<float>(Profiler::HISTOGRAM_BINS);
+    const std::size_t rows = m_stats.size() + 1; // 머리줄 + 구간들
+    window.setView(window.getDefaultView());
+    m_background.setPosition(0.f, 0.f);
+    m_background.setSize(sf::Vector2f(TEXT_WIDTH + barsWidth + PADDING * 3.f, ROW_HEIGHT * static_cast<float>(rows) + PADDING * 2.f));
+    window.draw(m_background);
+
+    std::wstring header = L"프로파일러 (F3 닫기, F4 trace ";
+    header += Profiler::instance().capturing() ? L"저장)" : L"캡처)";
+#ifndef IAPS_PROFILER
+    header = L"프로파일러가 빌드에서 꺼져 있음 (IAPS_ENABLE_PROFILER)";
+#endif
+    m_text.setString(header);
+    m_text.setPosition(PADDING, PADDING);
+    window.draw(m_text);
+
+    m_bars.clear();
+    for (std::size_t row = 0; row < m_stats.size(); ++row) {
+        const ProfileSectionStats& s = m_stats[row];
+        float y = PADDING + ROW_HEIGHT * static_cast<float>(row + 1);
+        std::ostringstream line;
+        line << std::left << std::setw(28) << (s.category + "/" + s.name) << std::right << std::fixed << std::setprecision(2)
+             << " p50 " << std::setw(6) << s.p50 * 1e3 << "  p99 " << std::setw(6) << s.p99 * 1e3 << " ms";
+        m_text.setString(line.str());
+        m_text.setPosition(PADDING, y);
+        window.draw(m_text);
+
+        std::uint32_t peak = std::max<std::uint32_t>(1, *std::max_element(s.histogram.begin(), s.histogram.end()));
+        float left = PADDING * 2.f + TEXT_WIDTH;
+        float bottom = y + ROW_HEIGHT - 3.f;
+        for (int bin = 0; bin < Profiler::HISTOGRAM_BINS; ++bin) {
+            if (s.histogram[bin] == 0) continue;
+            float height = (ROW_HEIGHT - 4.f) * static_cast<float>(s.histogram[bin]) / static_cast<float>(peak);
+            float x0 = left + BAR_WIDTH * static_cast<float>(bin), x1 = x0 + BAR_WIDTH - 1.f, y0 = bottom - height;
+            sf::Color color = bin >= 14 ? sf::Color(255, 90, 90) : sf::Color(90, 200, 255); // 16 ms 이상은 빨간색
+            const sf::Vector2f corners[6] = {{x0, y0}, {x1, y0}, {x1, bottom}, {x0, y0}, {x1, bottom}, {x0, bottom}};
+            for (const auto& corner : corners) m_bars.append(sf::Vertex(corner, color));
+        }
+    }
+    window.draw(m_bars);
+}
@@ -0,0 +1,41 @@
+#ifndef PROFILER_OVERLAY_HPP
+#define PROFILER_OVERLAY_HPP
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include "../core/Profiler.hpp"
+
+// 모든 화면 위에 겹쳐 그리는 프로파일러 오버레이
+// F3: 오버레이 표시/숨김 (표시하는 동안 프로파일러 켜짐), F4: Chrome trace 캡처 시작/종료 (종료 시 TRACE_FILE로 저장)
+// 구간마다 최근 p50/p99(ms)와 로그 구간 분포 막대를 보여 주며, 통계는 REFRESH_INTERVAL마다만 다시 계산
+class ProfilerOverlay {
+public:
+    explicit ProfilerOverlay(sf::Font& font);
+
+    // 오버레이 단축키 처리, 처리했으면 true (화면에는 전달하지 않음)
+    bool handleEvent(const sf::Event& event);
+    // 표시 중이면 기본 뷰로 창 왼쪽 위에 그리기 (display 직전에 호출)
+    void draw(sf::RenderWindow& window);
+    bool visible() const;
+
+    static const char* const TRACE_FILE;   // trace 저장 경로
+    static const sf::Time REFRESH_INTERVAL; // 통계 갱신 간격
+    static const unsigned CHARACTER_SIZE;   // 글자 크기
+    static const float ROW_HEIGHT;          // 구간 한 줄 높이 (픽셀)
+    static const float BAR_WIDTH;           // 분포 막대 하나 너비 (픽셀)
+
+private:
+    sf::Font& m_font;
+    bool m_visible;
+    sf::Clock m_refreshClock;
+    std::vector<ProfileSectionStats> m_stats; // 마지막으로 계산한 통계
+    sf::Text m_text;                          // 줄마다 다시 쓰는 텍스트
+    sf::RectangleShape m_background;
+    sf::VertexArray m_bars;                   // 분포 막대 전체 (삼각형 2개씩)
+
+    void updateEnabled(); // 표시 중이거나 캡처 중이면 프로파일러 켬
+    void toggleCapture();
+};
+
+#endif
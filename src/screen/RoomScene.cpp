@@ -0,0 +1,191 @@
+#include "RoomScene.hpp"
+#include <algorithm>
+
+RoomScene::RoomScene()
+    : m_rotationX(0.f), m_rotationY(0.f),
+      m_roomWidth(1.f), m_roomDepth(1.f), m_roomHeight(1.f),
+      m_center(0.f, 0.f), m_edgeColor(sf::Color::White), m_openingColor(sf::Color::White),
+      m_highlightIndex(-1), m_highlightColor(sf::Color::Yellow),
+      m_transformDirty(true), m_linesDirty(true), m_lines(sf::Lines) {
+    resetRoomOutline();
+}
+
+void RoomScene::setRoomOutline(const std::vector<Vec3D>& vertices, const std::vector<Edge>& edges) {
+    m_roomVertices = vertices;
+    m_roomEdges = edges;
+    m_linesDirty = true;
+}
+
+void RoomScene::resetRoomOutline() {
+    // 육면체 8개 정점의 로컬 좌표 (-0.5 ~ 0.5 범위로 정규화)
+    m_roomVertices = {
+        {-0.5f, -0.5f, -0.5f}, {0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, -0.5f}, {-0.5f, 0.5f, -0.5f}, // 앞면 (z=-0.5)
+        {-0.5f, -0.5f, 0.5f},  {0.5f, -0.5f, 0.5f},  {0.5f, 0.5f, 0.5f},  {-0.5f, 0.5f, 0.5f}   // 뒷면 (z=0.5)
+    };
+    // 육면체 12개 모서리 (각 모서리를 이루는 두 정점의 인덱스)
+    m_roomEdges = {
+        {0,1}, {1,2}, {2,3}, {3,0}, // 앞면 모서리
+        {4,5}, {5,6}, {6,7}, {7,4}, // 뒷면 모서리
+        {0,4}, {1,5}, {2,6}, {3,7}  // 앞면과 뒷면을 잇는 모서리
+    };
+    m_linesDirty = true;
+}
+
+void RoomScene::setRotation(float rotationX, float rotationY) {
+    if (rotationX == m_rotationX && rotationY == m_rotationY) return;
+    m_rotationX = rotationX;
+    m_rotationY = rotationY;
+    m_transformDirty = true;
+}
+
+void RoomScene::rotate(float deltaX, float deltaY) { setRotation(m_rotationX + deltaX, m_rotationY + deltaY); }
+
+void RoomScene::setRoomSize(float width, float depth, float height) {
+    if (width == m_roomWidth && depth == m_roomDepth && height == m_roomHeight) return;
+    m_roomWidth = width;
+    m_roomDepth = depth;
+    m_roomHeight = height;
+    m_transformDirty = true;
+}
+
+void RoomScene::setCenter(const sf::Vector2f& center) {
+    if (center == m_center) return;
+    m_center = center;
+    m_transformDirty = true;
+}
+
+void RoomScene::clearOpenings() {
+    if (m_openings.empty()) return;
+    m_openings.clear();
+    m_linesDirty = true;
+}
+
+void RoomScene::addOpening(const std::array<Vec3D, 4>& corners) {
+    m_openings.push_back(corners);
+    m_linesDirty = true;
+}
+
+void RoomScene::setOpening(std::size_t index, const std::array<Vec3D, 4>& corners) {
+    if (index >= m_openings.size()) return;
+    m_openings[index] = corners;
+    m_linesDirty = true;
+}
+
+void RoomScene::setColors(const sf::Color& edgeColor, const sf::Color& openingColor) {
+    m_edgeColor = edgeColor;
+    m_openingColor = openingColor;
+    m_linesDirty = true;
+}
+
+void RoomScene::setHighlight(int index, const sf::Color& color) {
+    if (index == m_highlightIndex && color == m_highlightColor) return;
+    m_highlightIndex = index;
+    m_highlightColor = color;
+    m_linesDirty = true;
+}
+
+// 캐시된 선 정점의 개구부 사각형(투영된 볼록 사각형)마다 점이 네 변의 같은 쪽에 있는지 검사
+int RoomScene::pickOpening(const sf::Vector2f& point) {
+    updateTransform();
+    if (m_linesDirty) rebuildLines();
+    const std::size_t base = m_roomEdges.size() * 2;
+    for (std::size_t o = m_openings.size(); o-- > 0;) {
+        bool hasPositive = false, hasNegative = false;
+        for (std::size_t i = 0; i < 4; ++i) { // 변 i는 선 정점 2i → 2i+1
+            sf::Vector2f a = m_lines[base + o * 8 + i * 2].position, b = m_lines[base + o * 8 + i * 2 + 1].position;
+            float cross = (b.x - a.x) * (point.y - a.y) - (b.y - a.y) * (point.x - a.x);
+            hasPositive = hasPositive || cross > 0.f;
+            hasNegative = hasNegative || cross < 0.f;
+        }
+        if (!(hasPositive && hasNegative)) return static_cast<int>(o);
+    }
+    return -1;
+}
+
+sf::Vector2f RoomScene::projectPoint(const Vec3D& local) {
+    updateTransform();
+    float x = 0.f, y = 0.f, perspective = 0.f;
+    m_transform.project(local, x, y, perspective);
+    return sf::Vector2f(x, y);
+}
+
+void RoomScene::updateTransform() {
+    if (!m_transformDirty) return;
+    m_transform.update(m_rotationX, m_rotationY, m_roomWidth, m_roomDepth, m_roomHeight, m_center.x, m_center.y);
+    m_transformDirty = false;
+    m_linesDirty = true; // 행렬이 바뀌면 캐시된 선 정점도 무효
+}
+
+// 방 윤곽선 정점과 개구부 꼭짓점(개구부당 4개)을 한 번에 투영한 뒤
+// 윤곽선 모서리와 개구부 사각형(개구부당 4개 선분)을 하나의 sf::Lines 배열에 채움
+void RoomScene::rebuildLines() {
+    const std::size_t numPoints = m_roomVertices.size() + m_openings.size() * 4;
+    m_pointX.clear(); m_pointY.clear(); m_pointZ.clear();
+    m_pointX.reserve(numPoints); m_pointY.reserve(numPoints); m_pointZ.reserve(numPoints);
+    auto addPoint = [this](const Vec3D& p) { m_pointX.push_back(p.x); m_pointY.push_back(p.y); m_pointZ.push_back(p.z); };
+    for (const Vec3D& v : m_roomVertices) addPoint(v);
+    for (const auto& opening : m_openings) {
+        for (const Vec3D& corner : opening) addPoint(corner);
+    }
+    projectPoints(m_pointX.data(), m_pointY.data(), m_pointZ.data(), numPoints);
+
+    auto screenPoint = [this](std::size_t i) { return sf::Vector2f(m_screenX[i], m_screenY[i]); };
+    m_lines.resize(m_roomEdges.size() * 2 + m_openings.size() * 8);
+    std::size_t v = 0;
+    for (const Edge& edge : m_roomEdges) {
+        m_lines[v++] = sf::Vertex(screenPoint(edge.start), m_edgeColor);
+        m_lines[v++] = sf::Vertex(screenPoint(edge.end), m_edgeColor);
+    }
+    for (std::size_t o = 0; o < m_openings.size(); ++o) {
+        std::size_t base = m_roomVertices.size() + o * 4;
+        const sf::Color& color = static_cast<int>(o) == m_highlightIndex ? m_highlightColor : m_openingColor;
+        for (std::size_t i = 0; i < 4; ++i) { // (i+1)%4는 순환 위함
+            m_lines[v++] = sf::Vertex(screenPoint(base + i), color);
+            m_lines[v++] = sf::Vertex(screenPoint(base + (i + 1) % 4), color);
+        }
+    }
+    m_linesDirty = false;
+}
+
+void RoomScene::draw(sf::RenderTarget& target) {
+    updateTransform();
+    if (m_linesDirty) rebuildLines();
+    target.draw(m_lines);
+}
+
+void RoomScene::projectPoints(const float* x, const float* y, const float* z, std::size_t n) {
+    updateTransform();
+    if (m_screenX.size() < n) { m_screenX.resize(n); m_screenY.resize(n); m_screenPerspective.resize(n); }
+    m_transform.projectBatch(x, y, z, m_screenX.data(), m_screenY.data(), m_screenPerspective.data(), n);
+}
+
+const float* RoomScene::screenX() const { return m_screenX.data(); }
+const float* RoomScene::screenY() const { return m_screenY.data(); }
+const float* RoomScene::perspective() const { return m_screenPerspective.data(); }
+
+void RoomScene::buildParticleQuads(const float* x, const float* y, const float* z, const float* alpha, std::size_t n,
+                                   const sf::Color& color, float radius, float textureSize, sf::VertexArray& vertices) {
+    const sf::Vector2f corners[4] = {{-1.f, -1.f}, {1.f, -1.f}, {1.f, 1.f}, {-1.f, 1.f}}; // 사각형 네 모서리 방향
+    const int quadOrder[6] = {0, 1, 2, 0, 2, 3}; // 사각형을 이루는 삼각형 두 개의 정점 순서
+    projectPoints(x, y, z, n);
+    vertices.resize(n * 6);
+    for (std::size_t i = 0; i < n; ++i) {
+        sf::Vector2f screenPos(m_screenX[i], m_screenY[i]); // 2D 화면 좌표
+
+        // 깊이(z값)에 따른 원근 효과 (크기 및 투명도 조절)
+        float depthPerspectiveFactor = std::max(0.2f, std::min(1.f, m_screenPerspective[i])); // 계수 범위 제한 (0.2 ~ 1.0)
+        float scaledRadius = radius * depthPerspectiveFactor;
+
+        sf::Color finalColor = color;
+        // 최종 알파값 = 현재 파티클 알파 * 깊이 계수 (멀수록 더 투명해짐)
+        finalColor.a = static_cast<sf::Uint8>(alpha[i] * depthPerspectiveFactor);
+
+        sf::Vertex* quad = &vertices[i * 6];
+        for (int v = 0; v < 6; ++v) {
+            const sf::Vector2f& corner = corners[quadOrder[v]];
+            quad[v].position = {screenPos.x + corner.x * scaledRadius, screenPos.y + corner.y * scaledRadius};
+            quad[v].color = finalColor;
+            quad[v].texCoords = {(corner.x + 1.f) * 0.5f * textureSize, (corner.y + 1.f) * 0.5f * textureSize};
+        }
+    }
+}
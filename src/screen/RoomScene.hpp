@@ -0,0 +1,83 @@
+#ifndef ROOM_SCENE_HPP
+#define ROOM_SCENE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+#include <cstddef>
+#include "../core/Geometry.hpp"
+#include "../core/ViewTransform.hpp"
+
+// 설정 화면과 시뮬레이션 화면이 공유하는 3D 방 장면 (카메라 + 와이어프레임)
+// 회전각/방 크기/화면 중심이 바뀔 때만 뷰 변환 행렬을 다시 계산하고,
+// 방 윤곽선(기본은 육면체, 다면체 방이면 그 윤곽선)과 개구부 사각형은 정점 배열 하나에 미리 만들어 두었다가 회전/크기/개구부가 바뀔 때만 다시 채움
+// 매 프레임 그리기는 캐시된 정점 배열을 한 번의 draw 호출로 출력
+class RoomScene {
+public:
+    RoomScene();
+
+    // 회전각 설정 (라디안)
+    void setRotation(float rotationX, float rotationY);
+    // 현재 회전각에 더하기 (마우스 드래그)
+    void rotate(float deltaX, float deltaY);
+    // 방 크기 설정 (m)
+    void setRoomSize(float width, float depth, float height);
+    // 투영 결과에 더할 화면 중심 (3D 뷰 중심)
+    void setCenter(const sf::Vector2f& center);
+
+    // 방 윤곽선 교체 (로컬 정규화 좌표 정점과 모서리, 다면체 방) / 기본 육면체로 되돌리기
+    void setRoomOutline(const std::vector<Vec3D>& vertices, const std::vector<Edge>& edges);
+    void resetRoomOutline();
+
+    // 개구부 목록 비우기 / 개구부 하나(로컬 정규화 좌표의 사각형 꼭짓점 4개) 추가
+    void clearOpenings();
+    void addOpening(const std::array<Vec3D, 4>& corners);
+    // 개구부 하나의 꼭짓점 교체 (끌어 옮기는 중 매 이동마다 호출)
+    void setOpening(std::size_t index, const std::array<Vec3D, 4>& corners);
+    // 선 색상 (방 윤곽선, 개구부)
+    void setColors(const sf::Color& edgeColor, const sf::Color& openingColor);
+    // 강조해 그릴 개구부 인덱스와 색상 (-1이면 강조 없음)
+    void setHighlight(int index, const sf::Color& color);
+
+    // 화면 좌표 point에 그려진 개구부 사각형 인덱스 (나중에 추가된 것 우선, 없으면 -1)
+    int pickOpening(const sf::Vector2f& point);
+    // 로컬 정규화 좌표 한 점의 화면 좌표
+    sf::Vector2f projectPoint(const Vec3D& local);
+
+    // 방 윤곽선과 개구부 전체를 한 번에 그리기 (변경된 경우에만 정점 재계산)
+    void draw(sf::RenderTarget& target);
+
+    // 로컬 정규화 좌표 n개를 일괄 투영 (결과는 screenX/screenY/perspective 앞쪽 n개, 다음 호출 전까지 유효)
+    void projectPoints(const float* x, const float* y, const float* z, std::size_t n);
+    const float* screenX() const;
+    const float* screenY() const;
+    const float* perspective() const;
+
+    // 파티클 n개(로컬 좌표, 투명도 0 ~ 255)를 투영해 텍스처 입힌 사각형(삼각형 2개씩) 정점으로 채우기
+    // 깊이 계수(0.2 ~ 1)로 반지름과 투명도를 줄여 원근감을 줌 (radius는 깊이 계수 1일 때 화면 반지름, textureSize는 텍스처 한 변)
+    void buildParticleQuads(const float* x, const float* y, const float* z, const float* alpha, std::size_t n,
+                            const sf::Color& color, float radius, float textureSize, sf::VertexArray& vertices);
+
+private:
+    ViewTransform m_transform;                  // 로컬 좌표 → 화면 좌표 변환 행렬
+    std::vector<Vec3D> m_roomVertices;          // 방 윤곽선 정점 (로컬 정규화 좌표)
+    std::vector<Edge> m_roomEdges;              // 방 윤곽선 모서리 정보
+    std::vector<std::array<Vec3D, 4>> m_openings; // 개구부 사각형 꼭짓점 (로컬 정규화 좌표)
+    float m_rotationX, m_rotationY;             // 회전 각도 (라디안)
+    float m_roomWidth, m_roomDepth, m_roomHeight; // 방 크기 (m)
+    sf::Vector2f m_center;                      // 화면 중심
+    sf::Color m_edgeColor, m_openingColor;      // 선 색상
+    int m_highlightIndex;                       // 강조할 개구부 (-1이면 없음)
+    sf::Color m_highlightColor;                 // 강조 색상
+    bool m_transformDirty;                      // 변환 행렬을 다시 계산해야 하는지
+    bool m_linesDirty;                          // 선 정점 배열을 다시 채워야 하는지
+
+    sf::VertexArray m_lines;                    // 캐시된 모서리 + 개구부 선분 (sf::Lines)
+    std::vector<float> m_pointX, m_pointY, m_pointZ; // 선 정점 재계산용 로컬 좌표 작업 배열
+    std::vector<float> m_screenX, m_screenY, m_screenPerspective; // 일괄 투영 결과 작업 배열
+
+    void updateTransform(); // 변경된 경우에만 변환 행렬 갱신
+    void rebuildLines();    // 모서리/개구부 꼭짓점을 투영해 선 정점 배열 채우기
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "Screen.hpp"
+#include "../core/Profiler.hpp"
 #include <iostream>
 #include <cmath>
 
@@ -152,6 +153,7 @@ void StartScreen::updateButtonStyles() {
 
 // 먼지 입자들의 위치 및 속도 업데이트
 void StartScreen::updateDustParticles(sf::Time dt) {
+    PROFILE_SCOPE("start", "dust.update");
     float deltaTime = dt.asSeconds(); // 경과 시간 (초 단위)
     sf::Vector2u windowSize = m_window.getSize(); // 현재 창 크기
 
@@ -234,50 +236,44 @@ void StartScreen::updateDustParticles(sf::Time dt) {
     }
 }
 
-// 사용자 입력 처리 함수
-void StartScreen::handleInput() {
-    m_mouseMovedSinceLastUpdate = false; // 매번 호출 시 마우스 움직임 플래그 초기화
-
-    sf::Event event; // 이벤트 객체
-    // 창에서 발생한 모든 이벤트 처리
-    while (m_window.pollEvent(event)) {
-        // 창 닫기 버튼 클릭 시
-        if (event.type == sf::Event::Closed) {
-            m_running = false; // 화면 실행 중단
-            m_nextState = ScreenState::EXIT; // 다음 상태를 종료로 설정
-        }
-        // ESC 키 누를 시
-        if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
-            m_running = false;
-            m_nextState = ScreenState::EXIT;
-        }
+// 이벤트 하나 처리 (메인 루프가 받은 이벤트)
+void StartScreen::handleEvent(const sf::Event& event) {
+    // 창 닫기 버튼 클릭 시
+    if (event.type == sf::Event::Closed) {
+        m_running = false; // 화면 실행 중단
+        m_nextState = ScreenState::EXIT; // 다음 상태를 종료로 설정
+    }
+    // ESC 키 누를 시
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
+        m_running = false;
+        m_nextState = ScreenState::EXIT;
+    }
 
-        // 마우스 움직임 이벤트 처리
-        if (event.type == sf::Event::MouseMoved) {
-            // 현재 마우스 위치 (뷰 좌표계 기준) 업데이트
-            m_mousePosition = m_window.mapPixelToCoords(sf::Vector2i(event.mouseMove.x, event.mouseMove.y));
-            m_mouseMovedSinceLastUpdate = true; // 마우스 움직임 발생 플래그 설정
+    // 마우스 움직임 이벤트 처리
+    if (event.type == sf::Event::MouseMoved) {
+        // 현재 마우스 위치 (뷰 좌표계 기준) 업데이트
+        m_mousePosition = m_window.mapPixelToCoords(sf::Vector2i(event.mouseMove.x, event.mouseMove.y));
+        m_mouseMovedSinceLastUpdate = true; // 마우스 움직임 발생 플래그 설정
 
-            // 버튼 위에 마우스가 있는지 확인하여 호버 상태 업데이트
-            sf::Vector2f mousePosView = m_window.mapPixelToCoords(sf::Mouse::getPosition(m_window));
-            m_isStartButtonHovered = m_startButtonShape.getGlobalBounds().contains(mousePosView);
-            m_isExitButtonHovered = m_exitButtonShape.getGlobalBounds().contains(mousePosView);
-        }
+        // 버튼 위에 마우스가 있는지 확인하여 호버 상태 업데이트
+        sf::Vector2f mousePosView = m_window.mapPixelToCoords(sf::Mouse::getPosition(m_window));
+        m_isStartButtonHovered = m_startButtonShape.getGlobalBounds().contains(mousePosView);
+        m_isExitButtonHovered = m_exitButtonShape.getGlobalBounds().contains(mousePosView);
+    }
 
-        // 마우스 버튼 클릭 이벤트 처리
-        if (event.type == sf::Event::MouseButtonPressed) {
-            if (event.mouseButton.button == sf::Mouse::Left) { // 왼쪽 버튼 클릭 시
-                sf::Vector2f mousePosView = m_window.mapPixelToCoords(sf::Mouse::getPosition(m_window));
-                // "실행" 버튼이 호버된 상태에서 클릭되었다면
-                if (m_isStartButtonHovered) {
-                    m_nextState = ScreenState::SETTING; // 다음 상태를 설정 화면으로
-                    m_running = false; // 현재 화면(StartScreen) 실행 중단
-                }
-                // "종료" 버튼이 호버된 상태에서 클릭되었다면
-                if (m_isExitButtonHovered) {
-                    m_running = false;
-                    m_nextState = ScreenState::EXIT;
-                }
+    // 마우스 버튼 클릭 이벤트 처리
+    if (event.type == sf::Event::MouseButtonPressed) {
+        if (event.mouseButton.button == sf::Mouse::Left) { // 왼쪽 버튼 클릭 시
+            sf::Vector2f mousePosView = m_window.mapPixelToCoords(sf::Mouse::getPosition(m_window));
+            // "실행" 버튼이 호버된 상태에서 클릭되었다면
+            if (m_isStartButtonHovered) {
+                m_nextState = ScreenState::SETTING; // 다음 상태를 설정 화면으로
+                m_running = false; // 현재 화면(StartScreen) 실행 중단
+            }
+            // "종료" 버튼이 호버된 상태에서 클릭되었다면
+            if (m_isExitButtonHovered) {
+                m_running = false;
+                m_nextState = ScreenState::EXIT;
             }
         }
     }
@@ -287,8 +283,14 @@ void StartScreen::handleInput() {
 void StartScreen::update(sf::Time dt) {
     updateButtonStyles();    // 버튼 스타일 업데이트 (호버 효과 등)
     updateDustParticles(dt); // 먼지 입자 상태 업데이트
+    m_mouseMovedSinceLastUpdate = false; // 마우스 움직임은 이번 프레임에 반영했으므로 초기화
 }
 
+// 먼지 입자가 계속 움직이므로 시작 화면은 항상 매 프레임 갱신
+bool StartScreen::isAnimating() const { return true; }
+bool StartScreen::needsRedraw() const { return true; }
+sf::Time StartScreen::idleTimeout() const { return sf::Time::Zero; }
+
 // 화면 렌더링 함수 (매 프레임 호출)
 void StartScreen::render() {
     m_window.clear(BACKGROUND_COLOR); // 지정된 배경색으로 화면 지우기
@@ -304,8 +306,6 @@ void StartScreen::render() {
     m_window.draw(m_startButtonText);
     m_window.draw(m_exitButtonShape);
     m_window.draw(m_exitButtonText);
-
-    m_window.display(); // 그려진 내용 실제 화면에 표시
 }
 
 // 다음 화면 상태 반환 함수
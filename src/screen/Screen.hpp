@@ -22,13 +22,20 @@ public:
     // 소멸자
     ~StartScreen();
 
-    // 사용자 입력을 처리하는 함수
-    void handleInput();
+    // 이벤트 하나를 처리하는 함수 (메인 루프가 받은 이벤트 전달)
+    void handleEvent(const sf::Event& event);
     // 화면의 상태를 업데이트하는 함수 (시간 경과에 따른 변화 등)
     void update(sf::Time dt); // dt: delta time (프레임 간 시간 간격)
-    // 화면의 모든 요소를 그리는 함수
+    // 화면의 모든 요소를 그리는 함수 (display는 메인 루프가 오버레이까지 그린 뒤 호출)
     void render();
 
+    // 매 프레임 갱신이 필요한지 (움직이는 요소가 있는지) 여부
+    bool isAnimating() const;
+    // 마지막 렌더링 이후 화면이 바뀌었는지 여부
+    bool needsRedraw() const;
+    // 애니메이션이 없을 때 이벤트 없이도 깨어나야 하는 최대 대기 시간 (Zero면 다음 이벤트까지 대기)
+    sf::Time idleTimeout() const;
+
     // 다음으로 전환될 화면 상태를 반환하는 함수
     ScreenState getNextState() const;
     // 다음 화면 상태를 설정하는 함수
@@ -2,11 +2,20 @@
 #include <cmath>
 #include <iostream>
 #include <algorithm>
-#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <filesystem>
 
 // PI 상수 정의 (원주율)
 const float PI = 3.1415926535f;
 
+// 입력창에 넣을 실수 문자열 (불필요한 0 없이)
+static std::string floatText(float value) {
+    std::ostringstream ss;
+    ss << value;
+    return ss.str();
+}
+
 // SettingScreen 클래스의 static const 멤버 변수 정의
 // 통로의 상대적 높이 비율 (방 높이 기준)
 const float SettingScreen::PASSAGE_RELATIVE_HEIGHT_FACTOR = 0.7f;
@@ -16,6 +25,11 @@ const float SettingScreen::PASSAGE_RELATIVE_WIDTH_FACTOR = 0.25f;
 const float SettingScreen::WINDOW_RELATIVE_HEIGHT_FACTOR = 0.5f;
 // 창문의 상대적 너비 비율 (방 깊이/너비 기준)
 const float SettingScreen::WINDOW_RELATIVE_WIDTH_FACTOR = 0.4f;
+// 마우스 휠 한 칸당 개구부 크기 배율
+const float SettingScreen::OPENING_RESIZE_STEP = 1.1f;
+
+// 입력 커서 깜빡임 간격 (초)
+const float InputBox::CURSOR_BLINK_INTERVAL = 0.5f;
 
 // InputBox 클래스 생성자: 멤버 변수 초기화
 InputBox::InputBox() : m_isActive(false), m_showCursor(false), m_font(nullptr) {}
@@ -77,17 +91,26 @@ void InputBox::handleEvent(sf::Event event) {
     }
 }
 
-// InputBox 상태 업데이트 함수 (커서 깜빡임 등)
-void InputBox::update() {
+// InputBox 상태 업데이트 함수 (커서 깜빡임 등), 커서 표시 상태가 바뀌면 true
+bool InputBox::update() {
+    bool wasShown = m_showCursor;
     if (m_isActive) { // 활성화 상태일 때만
         // 일정 시간마다 커서 보이기/숨기기 토글
-        if (m_cursorClock.getElapsedTime().asSeconds() > 0.5f) {
+        if (m_cursorClock.getElapsedTime().asSeconds() > CURSOR_BLINK_INTERVAL) {
             m_showCursor = !m_showCursor;
             m_cursorClock.restart(); // 타이머 재시작
         }
     } else {
         m_showCursor = false; // 비활성 시 커서 숨김
     }
+    return m_showCursor != wasShown;
+}
+
+// 다음 커서 깜빡임까지 남은 시간 (비활성 상태면 Zero)
+sf::Time InputBox::timeUntilCursorBlink() const {
+    if (!m_isActive) return sf::Time::Zero;
+    sf::Time remaining = sf::seconds(CURSOR_BLINK_INTERVAL) - m_cursorClock.getElapsedTime();
+    return std::max(remaining, sf::milliseconds(1)); // Zero는 "무한 대기"를 뜻하므로 최소 1ms
 }
 
 // InputBox 렌더링 함수
@@ -171,9 +194,8 @@ SettingScreen::SettingScreen(sf::RenderWindow& window, sf::Font& font)
     : m_window(window), m_font(font), // 멤버 변수 초기화 (창, 폰트)
       m_nextState(ScreenState::SETTING), m_running(true), // 화면 상태 및 실행 여부 초기화
       m_roomWidth(5.f), m_roomDepth(5.f), m_roomHeight(3.f), // 방 기본 크기 초기화
-      m_rotationX(25.f * PI / 180.f), // 3D 뷰 X축 초기 회전각 (라디안)
-      m_rotationY(-35.f * PI / 180.f), // 3D 뷰 Y축 초기 회전각 (라디안)
-      m_isDragging(false), m_selectedPollutantIndex(0), m_activeInputBox(nullptr) { // 기타 상태 변수 초기화
+      m_isDragging(false), m_isMovingOpening(false), m_dragPlacement{RoomFace::Front, 0.f, 0.f, 0.f, 0.f},
+      m_selectedPollutantIndex(0), m_activeInputBox(nullptr), m_needsRedraw(true), m_selectedOpening(-1) { // 기타 상태 변수 초기화
 
     // 버튼 스타일 색상 초기화
     m_buttonTextColorNormal = sf::Color::White;
@@ -182,10 +204,6 @@ SettingScreen::SettingScreen(sf::RenderWindow& window, sf::Font& font)
     m_buttonBgColorHover = sf::Color::White;
     m_buttonOutlineColor = sf::Color::White;
 
-    // 통로 및 창문 정의 벡터 메모리 예약 (최대 2개씩)
-    m_passages_defs.reserve(2);
-    m_windows_defs.reserve(2);
-
     // 3D 렌더링을 위한 뷰 설정
     m_3dView.setSize(static_cast<float>(m_window.getSize().x) * 0.6f, static_cast<float>(m_window.getSize().y)); // 뷰 크기 (창의 60% 너비)
     m_3dView.setCenter(m_3dView.getSize().x / 2.f, m_3dView.getSize().y / 2.f - 50.f); // 뷰 중심 (약간 위로 이동)
@@ -197,8 +215,7 @@ SettingScreen::SettingScreen(sf::RenderWindow& window, sf::Font& font)
     m_uiView.setViewport(sf::FloatRect(0.6f, 0.f, 0.4f, 1.f)); // 창의 오른쪽 40% 영역 사용
 
     setupUI();         // UI 요소 초기 설정 함수 호출
-    setup3D();         // 3D 모델 기본 구조 초기 설정 함수 호출
-    projectVertices(); // 3D 정점 초기 투영 계산 함수 호출
+    setup3D();         // 3D 장면(회전각, 방 크기, 선 색상) 초기 설정 함수 호출
 }
 
 // SettingScreen 클래스 소멸자 (현재 특별한 작업 없음)
@@ -208,12 +225,15 @@ SettingScreen::~SettingScreen() {}
 void SettingScreen::reset() {
     m_running = true; // 화면 실행 상태로 설정
     m_nextState = ScreenState::SETTING; // 다음 화면 상태를 자기 자신으로 (유지)
+    m_needsRedraw = true; // 화면 재진입 시 첫 프레임은 항상 그림
 
     // 활성화된 입력창이 있다면 비활성화
     if (m_activeInputBox) {
         m_activeInputBox->setActive(false);
         m_activeInputBox = nullptr;
     }
+    m_isDragging = false;
+    m_isMovingOpening = false;
     // 필요에 따라 추가적인 초기화 로직 (예: 입력 필드 값 초기화 등)
 }
 
@@ -343,7 +363,13 @@ void SettingScreen::setupUI() {
     m_textPassageCount.setFont(m_font);
     m_textPassageCount.setCharacterSize(countCharSize);
     m_textPassageCount.setFillColor(sf::Color::White);
-    updatePassageCountText(); // 초기 텍스트 내용 설정
+    m_textWindowCount.setFont(m_font);
+    m_textWindowCount.setCharacterSize(countCharSize);
+    m_textWindowCount.setFillColor(sf::Color::White);
+    m_textExchange.setFont(m_font);
+    m_textExchange.setCharacterSize(countCharSize);
+    m_textExchange.setFillColor(sf::Color::White);
+    updateOpeningTexts(); // 초기 텍스트 내용 설정
 
     sf::FloatRect passageCountBounds = m_textPassageCount.getLocalBounds();
     // "통로 제거" 버튼 중앙 하단에 위치하도록 설정
@@ -353,11 +379,6 @@ void SettingScreen::setupUI() {
     );
 
     // 창문 개수 텍스트
-    m_textWindowCount.setFont(m_font);
-    m_textWindowCount.setCharacterSize(countCharSize);
-    m_textWindowCount.setFillColor(sf::Color::White);
-    updateWindowCountText(); // 초기 텍스트 내용 설정
-
     sf::FloatRect windowCountBounds = m_textWindowCount.getLocalBounds();
     // "창문 제거" 버튼 중앙 하단에 위치하도록 설정
     m_textWindowCount.setPosition(
@@ -368,73 +389,52 @@ void SettingScreen::setupUI() {
     currentY += spacing; // 다음 Y 위치 조정
     currentY += spacing * 0.5f; // 추가 간격
 
+    // 환기량 텍스트 (개수 텍스트 아래 가운데)
+    m_textExchange.setPosition(std::round(uiX + maxUiElementWidth / 2.f), std::round(currentY));
+    currentY += spacing;
+
+    // 개구부 편집 안내 텍스트 (왼쪽 정렬)
+    m_textOpeningHelp.setFont(m_font);
+    m_textOpeningHelp.setCharacterSize(countCharSize);
+    m_textOpeningHelp.setFillColor(sf::Color(170, 170, 170));
+    m_textOpeningHelp.setString(L"3D 뷰에서 개구부 클릭 후 끌기: 면을 따라 이동\n"
+                                L"(모서리를 넘으면 옆 면으로)\n"
+                                L"마우스 휠: 크기 (Shift: 가로, Ctrl: 세로)\n"
+                                L"Delete: 선택한 개구부 제거");
+    m_textOpeningHelp.setPosition(std::round(uiX), std::round(currentY));
+    currentY += spacing * 2.5f; // 안내 네 줄
+
+    // 다면체 방 정보 텍스트와 직육면체로 되돌리기 버튼 (다면체 방일 때만 그림)
+    m_textRoomMesh.setFont(m_font);
+    m_textRoomMesh.setCharacterSize(countCharSize);
+    m_textRoomMesh.setFillColor(sf::Color::Cyan);
+    m_textRoomMesh.setPosition(std::round(uiX), std::round(currentY));
+    currentY += spacing * 1.2f; // 정보 두 줄
+    setupButtonLambda(m_buttonResetRoom, m_shapeResetRoom, L"직육면체로", currentY, singleButtonWidth);
+
     // "시뮬레이션 시작" 버튼 설정 (화면 하단에 위치)
     float startButtonY = m_uiView.getSize().y - spacing - inputHeight;
     setupButtonLambda(m_buttonStartSimulation, m_shapeStartSimulation, L"시뮬레이션 시작", startButtonY, singleButtonWidth);
+    // 시나리오 저장/불러오기 버튼 (시작 버튼 바로 위)
+    float scenarioButtonsY = startButtonY - spacing;
+    setupButtonLambda(m_buttonSaveScenario, m_shapeSaveScenario, L"저장 (Ctrl+S)", scenarioButtonsY, pairedButtonWidth);
+    setupButtonLambda(m_buttonLoadScenario, m_shapeLoadScenario, L"불러오기 (Ctrl+O)", scenarioButtonsY, pairedButtonWidth, pairedButtonWidth + 10.f);
 }
 
-// 3D 육면체 모델의 기본 정점 및 모서리 정보 설정
+// 3D 장면 초기 설정 (방 윤곽선 정점/모서리와 변환 행렬은 RoomScene이 관리)
 void SettingScreen::setup3D() {
-    // 육면체 8개 정점의 로컬 좌표 (-0.5 ~ 0.5 범위로 정규화)
-    m_cubeVertices = {{
-        {-0.5f, -0.5f, -0.5f}, {0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, -0.5f}, {-0.5f, 0.5f, -0.5f}, // 앞면 (z=-0.5)
-        {-0.5f, -0.5f, 0.5f},  {0.5f, -0.5f, 0.5f},  {0.5f, 0.5f, 0.5f},  {-0.5f, 0.5f, 0.5f}     // 뒷면 (z=0.5)
-    }};
-    // 육면체 12개 모서리 (각 모서리를 이루는 두 정점의 인덱스)
-    m_cubeEdges = {
-        {0,1}, {1,2}, {2,3}, {3,0}, // 앞면 모서리
-        {4,5}, {5,6}, {6,7}, {7,4}, // 뒷면 모서리
-        {0,4}, {1,5}, {2,6}, {3,7}  // 앞면과 뒷면을 잇는 모서리
-    };
-    m_transformedVertices.fill({}); // 변환된 정점 배열 초기화 (0으로 채움)
-}
-
-// 3D 정점들을 현재 방 크기, 회전각에 따라 변환하는 함수
-void SettingScreen::projectVertices() {
-    // 입력된 방 크기 가져오기 (최소값 0.1f 보장)
-    float w = (m_roomWidth > 0.1f) ? m_roomWidth : 0.1f;
-    float d = (m_roomDepth > 0.1f) ? m_roomDepth : 0.1f;
-    float h = (m_roomHeight > 0.1f) ? m_roomHeight : 0.1f;
-
-    // 3D 뷰에 맞게 스케일링하기 위한 최대 차원값 및 스케일 팩터 계산
-    float maxDim = std::max({w, d, h, 1.f}); // 방 크기 중 가장 큰 값 (최소 1.0f)
-    float scaleFactor = 350.f / maxDim;      // 뷰 크기에 맞추기 위한 비율 (350은 임의의 기준 크기)
-
-    // 모든 정점에 대해 변환 적용
-    for (size_t i = 0; i < m_cubeVertices.size(); ++i) {
-        const Vec3D& v_orig = m_cubeVertices[i]; // 원본 정규화 좌표
-        Vec3D v_scaled; // 방 크기 적용된 좌표
-        v_scaled.x = v_orig.x * w;
-        v_scaled.y = v_orig.y * h; // Y축은 SFML 화면 좌표계와 유사하게 아래로 갈수록 증가하는 것으로 간주
-        v_scaled.z = v_orig.z * d;
-
-        // Y축 기준 회전 (방향키 좌우 또는 마우스 좌우 드래그에 해당)
-        float x_rot_y = v_scaled.x * std::cos(m_rotationY) - v_scaled.z * std::sin(m_rotationY);
-        float z_rot_y = v_scaled.x * std::sin(m_rotationY) + v_scaled.z * std::cos(m_rotationY);
-
-        // X축 기준 회전 (방향키 상하 또는 마우스 상하 드래그에 해당)
-        float y_final = v_scaled.y * std::cos(m_rotationX) - z_rot_y * std::sin(m_rotationX);
-        float z_final = v_scaled.y * std::sin(m_rotationX) + z_rot_y * std::cos(m_rotationX);
-
-        // 최종 변환된 좌표 (스케일 팩터 적용)
-        m_transformedVertices[i] = {
-            x_rot_y * scaleFactor,
-            y_final * scaleFactor,
-            z_final * scaleFactor
-        };
-    }
+    m_scene.setCenter(m_3dView.getCenter()); // 3D 뷰 중심을 투영 중심으로
+    m_scene.setRotation(25.f * PI / 180.f, -35.f * PI / 180.f); // 3D 뷰 초기 회전각 (X축 25도, Y축 -35도)
+    m_scene.setColors(sf::Color::White, sf::Color::White); // 모서리와 개구부 모두 흰색
+    m_scene.setHighlight(m_selectedOpening, sf::Color::Yellow); // 선택한 개구부는 노란색
+    m_scene.setRoomSize(m_roomWidth, m_roomDepth, m_roomHeight);
 }
 
-// 3D 좌표를 2D 화면 좌표로 투영하는 함수 (간단한 원근 투영)
-sf::Vector2f SettingScreen::project(const Vec3D& p) const {
-    sf::Vector2f viewCenter = m_3dView.getCenter(); // 3D 뷰의 중심 좌표
-    // 원근 효과 계수: z값이 클수록 (멀리 있을수록) 작게, z값이 -500에 가까워지면 무한대로 발산 (시야각 효과)
-    float perspectiveFactor = 500.f / (500.f + p.z); 
-    // 투영된 2D 화면 좌표 계산 및 반환
-    return sf::Vector2f(
-        std::round(p.x * perspectiveFactor + viewCenter.x), // X 좌표 투영 및 뷰 중심으로 이동
-        std::round(p.y * perspectiveFactor + viewCenter.y)  // Y 좌표 투영 및 뷰 중심으로 이동
-    );
+// 추가한 순서 그대로 3D 장면의 개구부 목록 갱신 (개구부 생성/제거 시 호출, 선 정점은 다음 그리기 때 한 번만 재계산)
+void SettingScreen::updateSceneOpenings() {
+    m_scene.clearOpenings();
+    for (const auto& opening : m_openings) m_scene.addOpening(opening.corners());
+    m_scene.setHighlight(m_selectedOpening, sf::Color::Yellow);
 }
 
 // 활성화된 입력 상자의 이벤트를 처리하는 함수
@@ -447,142 +447,241 @@ void SettingScreen::handleInputBoxEvents(sf::Event event) {
             if (currentActive == &m_inputWidth) m_roomWidth = m_inputWidth.getFloatValue();
             else if (currentActive == &m_inputDepth) m_roomDepth = m_inputDepth.getFloatValue();
             else if (currentActive == &m_inputHeight) m_roomHeight = m_inputHeight.getFloatValue();
-            projectVertices(); // 방 크기 변경 시 3D 모델 즉시 업데이트
+            m_scene.setRoomSize(m_roomWidth, m_roomDepth, m_roomHeight); // 방 크기 변경 시 3D 모델 갱신 (값이 바뀐 경우에만)
+            updateOpeningTexts(); // 개구부 실제 넓이가 바뀌므로 환기량 갱신
         }
     }
 }
 
-// 현재 설정값들을 파일에 저장하는 함수
-void SettingScreen::saveSettingsToFile(const std::string& filename) const {
-    std::ofstream outFile(filename); // 파일 출력 스트림 열기
-    if (outFile.is_open()) { // 파일 열기 성공 시
-        // "키:값" 형식으로 설정 정보 저장
-        outFile << "width:" << m_roomWidth << std::endl;
-        outFile << "depth:" << m_roomDepth << std::endl;
-        outFile << "height:" << m_roomHeight << std::endl;
-        outFile << "pollutant_index:" << m_selectedPollutantIndex << std::endl;
-        outFile << "passages_count:" << m_passages_defs.size() << std::endl;
-        outFile << "windows_count:" << m_windows_defs.size() << std::endl;
-        outFile.close(); // 파일 닫기
-        std::cout << "Settings saved to " << filename << std::endl; // 저장 완료 메시지 (디버깅용)
-    } else { // 파일 열기 실패 시
-        std::cerr << "Error: Could not open file to save settings: " << filename << std::endl;
+// 현재 설정값으로 시나리오 만들기 (개구부는 추가한 순서)
+Scenario SettingScreen::scenario() const {
+    Scenario result;
+    result.width = m_roomWidth;
+    result.depth = m_roomDepth;
+    result.height = m_roomHeight;
+    result.pollutantIndex = m_selectedPollutantIndex;
+    result.openings = m_openings;
+    result.mesh = m_mesh;
+    return result;
+}
+
+// 다면체 방 파일을 불러와 방 크기를 모델 경계 상자로 맞춤 (개구부는 경계 상자 면 기준이라 그대로 유지)
+bool SettingScreen::importRoomMesh(const std::string& filename) {
+    auto mesh = std::make_shared<RoomMesh>();
+    if (!mesh->loadFromFile(filename)) return false;
+    m_roomWidth = mesh->width();
+    m_roomDepth = mesh->depth();
+    m_roomHeight = mesh->height();
+    m_inputWidth.setText(floatText(m_roomWidth));
+    m_inputDepth.setText(floatText(m_roomDepth));
+    m_inputHeight.setText(floatText(m_roomHeight));
+    m_scene.setRoomSize(m_roomWidth, m_roomDepth, m_roomHeight);
+    setRoomMesh(std::move(mesh));
+    std::cout << "Room mesh loaded from " << filename << " (" << m_mesh->triangleCount() << " triangles, "
+              << m_mesh->volume() << " m^3)" << std::endl;
+    return true;
+}
+
+void SettingScreen::setRoomMesh(std::shared_ptr<const RoomMesh> mesh) {
+    m_mesh = std::move(mesh);
+    if (m_mesh) {
+        m_scene.setRoomOutline(m_mesh->outlineVertices(), m_mesh->outlineEdges());
+        std::wstring name;
+        for (char c : std::filesystem::path(m_mesh->filename()).filename().string()) name += static_cast<wchar_t>(static_cast<unsigned char>(c));
+        std::wostringstream ss;
+        ss << L"다면체 방: " << name << L"\n삼각형 " << m_mesh->triangleCount() << L"개, 경계 상자의 "
+           << std::fixed << std::setprecision(0) << m_mesh->fillFraction() * 100.f << L"%";
+        m_textRoomMesh.setString(ss.str());
+    } else {
+        m_scene.resetRoomOutline();
+    }
+    updateOpeningTexts(); // 부피가 바뀌므로 환기량의 K 증가분 갱신
+    m_needsRedraw = true;
+}
+
+// 현재 설정을 시나리오 파일로 저장
+void SettingScreen::saveScenario() const {
+    if (scenario().saveToFile(Scenario::DEFAULT_FILE)) {
+        std::cout << "Scenario saved to " << Scenario::DEFAULT_FILE << std::endl;
     }
 }
 
-// 사용자 입력 처리 함수 (메인 루프에서 호출)
-void SettingScreen::handleInput() {
-    sf::Event event; // SFML 이벤트 객체
-    // 창에서 발생한 모든 이벤트 폴링
-    while (m_window.pollEvent(event)) {
-        // 창 닫기 이벤트 처리
-        if (event.type == sf::Event::Closed) {
+// 시나리오 파일을 불러와 화면에 반영 (읽기 실패 시 현재 설정 유지)
+void SettingScreen::loadScenario() {
+    Scenario loaded;
+    if (!loaded.loadFromFile(Scenario::DEFAULT_FILE)) return;
+    applyScenario(loaded);
+    std::cout << "Scenario loaded from " << Scenario::DEFAULT_FILE << std::endl;
+}
+
+// 시나리오 값을 화면 상태에 반영
+void SettingScreen::applyScenario(const Scenario& scenario) {
+    m_roomWidth = scenario.width;
+    m_roomDepth = scenario.depth;
+    m_roomHeight = scenario.height;
+    m_selectedPollutantIndex = scenario.pollutantIndex;
+    m_inputWidth.setText(floatText(m_roomWidth));
+    m_inputDepth.setText(floatText(m_roomDepth));
+    m_inputHeight.setText(floatText(m_roomHeight));
+
+    m_openings = scenario.openings;
+    m_selectedOpening = -1;
+    m_isMovingOpening = false;
+    m_scene.setRoomSize(m_roomWidth, m_roomDepth, m_roomHeight);
+    updateSceneOpenings();
+    setRoomMesh(scenario.mesh); // 환기량 텍스트도 함께 갱신
+}
+
+// 이벤트 하나 처리 (메인 루프가 받은 이벤트)
+void SettingScreen::handleEvent(const sf::Event& event) {
+    m_needsRedraw = true; // 마우스 이동/키 입력 등 모든 이벤트는 화면을 바꿀 수 있으므로 다시 그림
+    // 창 닫기 이벤트 처리
+    if (event.type == sf::Event::Closed) {
+        m_running = false; // 화면 실행 중단
+        m_nextState = ScreenState::EXIT; // 다음 상태를 종료로 설정
+    }
+    // ESC 키 누름 이벤트 처리
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
+        if (m_activeInputBox) { // 활성화된 입력창이 있으면
+            m_activeInputBox->setActive(false); // 입력창 비활성화
+            m_activeInputBox = nullptr;
+        } else if (m_selectedOpening >= 0) { // 선택한 개구부가 있으면 선택 해제
+            selectOpening(-1);
+        } else { // 활성화된 입력창이 없으면
             m_running = false; // 화면 실행 중단
-            m_nextState = ScreenState::EXIT; // 다음 상태를 종료로 설정
-        }
-        // ESC 키 누름 이벤트 처리
-        if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
-            if (m_activeInputBox) { // 활성화된 입력창이 있으면
-                m_activeInputBox->setActive(false); // 입력창 비활성화
-                m_activeInputBox = nullptr;
-            } else { // 활성화된 입력창이 없으면
-                m_running = false; // 화면 실행 중단
-                m_nextState = ScreenState::START; // 다음 상태를 시작 화면으로 설정
-            }
+            m_nextState = ScreenState::START; // 다음 상태를 시작 화면으로 설정
         }
+    }
+    // Ctrl+S / Ctrl+O: 시나리오 파일 저장 / 불러오기 (입력창이 비활성일 때만)
+    if (event.type == sf::Event::KeyPressed && event.key.control && !m_activeInputBox) {
+        if (event.key.code == sf::Keyboard::S) saveScenario();
+        else if (event.key.code == sf::Keyboard::O) loadScenario();
+    }
+    // Delete: 선택한 개구부 제거 (입력창이 비활성일 때만)
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Delete && !m_activeInputBox && m_selectedOpening >= 0) {
+        removeOpening(m_openings[m_selectedOpening].kind());
+    }
 
-        // 활성화된 입력창의 텍스트 입력 이벤트 우선 처리
-        if (m_activeInputBox && event.type == sf::Event::TextEntered) {
-            handleInputBoxEvents(event);
-            continue; // 이 이벤트는 처리했으므로 다음 이벤트 폴링으로 넘어감
-        }
-        // 활성화된 입력창의 키 누름 이벤트 처리 (백스페이스 등)
-        if (m_activeInputBox && event.type == sf::Event::KeyPressed) {
-            handleInputBoxEvents(event);
-            // 여기서 continue를 하면 다른 키 입력(예: ESC)이 막힐 수 있으므로 주의
-        }
+    // 활성화된 입력창의 텍스트 입력 이벤트 우선 처리
+    if (m_activeInputBox && event.type == sf::Event::TextEntered) {
+        handleInputBoxEvents(event);
+        return; // 이 이벤트는 처리 완료
+    }
+    // 활성화된 입력창의 키 누름 이벤트 처리 (백스페이스 등)
+    if (m_activeInputBox && event.type == sf::Event::KeyPressed) {
+        handleInputBoxEvents(event);
+        // 여기서 continue를 하면 다른 키 입력(예: ESC)이 막힐 수 있으므로 주의
+    }
 
-        // 마우스 버튼 누름 이벤트 처리
-        if (event.type == sf::Event::MouseButtonPressed) {
-            if (event.mouseButton.button == sf::Mouse::Left) { // 왼쪽 마우스 버튼
-                sf::Vector2f mousePosWindow = static_cast<sf::Vector2f>(sf::Mouse::getPosition(m_window)); // 창 기준 마우스 위치
-                sf::Vector2f mousePosUI = m_window.mapPixelToCoords(sf::Mouse::getPosition(m_window), m_uiView); // UI 뷰 기준 마우스 위치
+    // 마우스 버튼 누름 이벤트 처리
+    if (event.type == sf::Event::MouseButtonPressed) {
+        if (event.mouseButton.button == sf::Mouse::Left) { // 왼쪽 마우스 버튼
+            sf::Vector2f mousePosWindow = static_cast<sf::Vector2f>(sf::Mouse::getPosition(m_window)); // 창 기준 마우스 위치
+            sf::Vector2f mousePosUI = m_window.mapPixelToCoords(sf::Mouse::getPosition(m_window), m_uiView); // UI 뷰 기준 마우스 위치
 
-                InputBox* previouslyActive = m_activeInputBox; // 이전 활성 입력창
-                InputBox* clickedBox = nullptr; // 새로 클릭된 입력창
+            InputBox* previouslyActive = m_activeInputBox; // 이전 활성 입력창
+            InputBox* clickedBox = nullptr; // 새로 클릭된 입력창
 
-                // 어떤 입력창이 클릭되었는지 확인
-                if (m_inputWidth.getGlobalBounds().contains(mousePosUI)) clickedBox = &m_inputWidth;
-                else if (m_inputDepth.getGlobalBounds().contains(mousePosUI)) clickedBox = &m_inputDepth;
-                else if (m_inputHeight.getGlobalBounds().contains(mousePosUI)) clickedBox = &m_inputHeight;
+            // 어떤 입력창이 클릭되었는지 확인
+            if (m_inputWidth.getGlobalBounds().contains(mousePosUI)) clickedBox = &m_inputWidth;
+            else if (m_inputDepth.getGlobalBounds().contains(mousePosUI)) clickedBox = &m_inputDepth;
+            else if (m_inputHeight.getGlobalBounds().contains(mousePosUI)) clickedBox = &m_inputHeight;
 
-                // 활성 입력창 변경 처리
-                if (previouslyActive && previouslyActive != clickedBox) {
-                    previouslyActive->setActive(false); // 이전 입력창 비활성화
-                }
-                m_activeInputBox = clickedBox; // 새 입력창을 활성 입력창으로
-                if (m_activeInputBox) {
-                    m_activeInputBox->setActive(true); // 활성화 시각 효과 적용
-                }
+            // 활성 입력창 변경 처리
+            if (previouslyActive && previouslyActive != clickedBox) {
+                previouslyActive->setActive(false); // 이전 입력창 비활성화
+            }
+            m_activeInputBox = clickedBox; // 새 입력창을 활성 입력창으로
+            if (m_activeInputBox) {
+                m_activeInputBox->setActive(true); // 활성화 시각 효과 적용
+            }
 
-                // 입력창이 아닌 곳을 클릭했다면 오염물질 선택 옵션 확인
-                if (!m_activeInputBox) {
-                    for(size_t i=0; i<m_pollutantOptionShapes.size(); ++i) {
-                        if (m_pollutantOptionShapes[i].getGlobalBounds().contains(mousePosUI)) {
-                            m_selectedPollutantIndex = static_cast<int>(i); // 선택된 오염물질 인덱스 업데이트
-                            break; // 하나만 선택 가능
-                        }
+            // 입력창이 아닌 곳을 클릭했다면 오염물질 선택 옵션 확인
+            if (!m_activeInputBox) {
+                for(size_t i=0; i<m_pollutantOptionShapes.size(); ++i) {
+                    if (m_pollutantOptionShapes[i].getGlobalBounds().contains(mousePosUI)) {
+                        m_selectedPollutantIndex = static_cast<int>(i); // 선택된 오염물질 인덱스 업데이트
+                        break; // 하나만 선택 가능
                     }
                 }
+            }
 
-                // 입력창이 활성화되지 않았을 때만 다른 버튼들 작동
-                if (!m_activeInputBox) {
-                    if (m_shapeCreatePassage.getGlobalBounds().contains(mousePosUI)) {
-                        createPassage(); // 통로 생성
-                    } else if (m_shapeRemovePassage.getGlobalBounds().contains(mousePosUI)) {
-                        removePassage(); // 통로 제거
-                    } else if (m_shapeCreateWindow.getGlobalBounds().contains(mousePosUI)) {
-                        createWindow(); // 창문 생성
-                    } else if (m_shapeRemoveWindow.getGlobalBounds().contains(mousePosUI)) {
-                        removeWindow(); // 창문 제거
-                    } else if (m_shapeStartSimulation.getGlobalBounds().contains(mousePosUI)) { // "시뮬레이션 시작" 버튼 클릭
-                        saveSettingsToFile("Setting_values.text"); // 현재 설정값 파일에 저장
-                        m_nextState = ScreenState::SIMULATION;     // 다음 화면 상태를 시뮬레이션으로
-                        m_running = false;                         // 현재 설정 화면 종료
-                    }
+            // 입력창이 활성화되지 않았을 때만 다른 버튼들 작동
+            if (!m_activeInputBox) {
+                if (m_shapeCreatePassage.getGlobalBounds().contains(mousePosUI)) {
+                    createOpening(OpeningKind::Passage); // 통로 생성
+                } else if (m_shapeRemovePassage.getGlobalBounds().contains(mousePosUI)) {
+                    removeOpening(OpeningKind::Passage); // 통로 제거
+                } else if (m_shapeCreateWindow.getGlobalBounds().contains(mousePosUI)) {
+                    createOpening(OpeningKind::Window); // 창문 생성
+                } else if (m_shapeRemoveWindow.getGlobalBounds().contains(mousePosUI)) {
+                    removeOpening(OpeningKind::Window); // 창문 제거
+                } else if (m_shapeSaveScenario.getGlobalBounds().contains(mousePosUI)) {
+                    saveScenario(); // 시나리오 파일 저장
+                } else if (m_shapeLoadScenario.getGlobalBounds().contains(mousePosUI)) {
+                    loadScenario(); // 시나리오 파일 불러오기
+                } else if (m_mesh && m_shapeResetRoom.getGlobalBounds().contains(mousePosUI)) {
+                    setRoomMesh(nullptr); // 다면체 방 해제 (방 크기는 유지)
+                } else if (m_shapeStartSimulation.getGlobalBounds().contains(mousePosUI)) { // "시뮬레이션 시작" 버튼 클릭 (설정값은 main이 scenario()로 전달)
+                    m_nextState = ScreenState::SIMULATION;     // 다음 화면 상태를 시뮬레이션으로
+                    m_running = false;                         // 현재 설정 화면 종료
                 }
+            }
 
-                // 3D 뷰 영역 클릭 시 마우스 드래그 시작 (입력창이 활성화되지 않았을 때만)
-                sf::FloatRect view3DViewportRect( // 3D 뷰의 화면상 실제 영역 계산
-                    m_3dView.getViewport().left * m_window.getSize().x,
-                    m_3dView.getViewport().top * m_window.getSize().y,
-                    m_3dView.getViewport().width * m_window.getSize().x,
-                    m_3dView.getViewport().height * m_window.getSize().y
-                );
-                if (view3DViewportRect.contains(mousePosWindow) && !m_activeInputBox) { // 3D 뷰 영역 내 클릭이고 입력창 비활성 시
+            // 3D 뷰 영역 클릭 시 마우스 드래그 시작 (입력창이 활성화되지 않았을 때만)
+            sf::FloatRect view3DViewportRect( // 3D 뷰의 화면상 실제 영역 계산
+                m_3dView.getViewport().left * m_window.getSize().x,
+                m_3dView.getViewport().top * m_window.getSize().y,
+                m_3dView.getViewport().width * m_window.getSize().x,
+                m_3dView.getViewport().height * m_window.getSize().y
+            );
+            if (view3DViewportRect.contains(mousePosWindow) && !m_activeInputBox) { // 3D 뷰 영역 내 클릭이고 입력창 비활성 시
+                // 개구부 위를 눌렀으면 선택해 끌어 옮기고, 빈 곳이면 선택 해제 후 뷰 회전
+                m_lastMousePos = sf::Mouse::getPosition(m_window); // 현재 마우스 위치 저장 (드래그 기준점)
+                selectOpening(m_scene.pickOpening(m_window.mapPixelToCoords(m_lastMousePos, m_3dView)));
+                if (m_selectedOpening >= 0) {
+                    m_isMovingOpening = true;
+                    m_dragPlacement = m_openings[m_selectedOpening].placement();
+                } else {
                     m_isDragging = true; // 드래그 시작 플래그
-                    m_lastMousePos = sf::Mouse::getPosition(m_window); // 현재 마우스 위치 저장 (드래그 기준점)
                 }
             }
         }
-        // 마우스 버튼 뗌 이벤트 처리
-        if (event.type == sf::Event::MouseButtonReleased) {
-            if (event.mouseButton.button == sf::Mouse::Left) {
-                m_isDragging = false; // 드래그 종료
-            }
+    }
+    // 마우스 버튼 뗌 이벤트 처리
+    if (event.type == sf::Event::MouseButtonReleased) {
+        if (event.mouseButton.button == sf::Mouse::Left) {
+            m_isDragging = false; // 드래그 종료
+            m_isMovingOpening = false;
         }
-        // 마우스 이동 이벤트 처리 (3D 뷰 회전용)
-        if (event.type == sf::Event::MouseMoved) {
-            if (m_isDragging && !m_activeInputBox) { // 드래그 중이고 입력창 비활성 시
-                sf::Vector2i currentMousePos = sf::Mouse::getPosition(m_window);
+    }
+    // 마우스 이동 이벤트 처리 (3D 뷰 회전 또는 개구부 이동)
+    if (event.type == sf::Event::MouseMoved) {
+        if ((m_isDragging || m_isMovingOpening) && !m_activeInputBox) { // 드래그 중이고 입력창 비활성 시
+            sf::Vector2i currentMousePos = sf::Mouse::getPosition(m_window);
+            if (m_isMovingOpening) {
+                // 3D 뷰 좌표 기준 이동량으로 개구부 이동
+                moveSelectedOpening(m_window.mapPixelToCoords(currentMousePos, m_3dView) - m_window.mapPixelToCoords(m_lastMousePos, m_3dView));
+            } else {
                 float dx = static_cast<float>(currentMousePos.x - m_lastMousePos.x); // X축 이동량
-
-                m_rotationY += dx * 0.005f; // Y축 회전각 업데이트 (회전 민감도 0.005)
-                m_lastMousePos = currentMousePos; // 마지막 마우스 위치 갱신
-                projectVertices(); // 회전된 3D 모델 재투영
+                m_scene.rotate(0.f, dx * 0.005f); // Y축 회전각 업데이트 (회전 민감도 0.005, 변환은 다음 그리기 때 갱신)
             }
+            m_lastMousePos = currentMousePos; // 마지막 마우스 위치 갱신
         }
     }
+    // 마우스 휠: 선택한 개구부 크기 조절 (3D 뷰 위에서만)
+    if (event.type == sf::Event::MouseWheelScrolled && !m_activeInputBox && m_selectedOpening >= 0 &&
+        event.mouseWheelScroll.x < static_cast<int>(m_3dView.getViewport().width * m_window.getSize().x)) {
+        resizeSelectedOpening(event.mouseWheelScroll.delta);
+    }
+}
+
+// 설정 화면에는 스스로 움직이는 요소가 없음 (회전/입력은 모두 이벤트로 처리)
+bool SettingScreen::isAnimating() const { return false; }
+bool SettingScreen::needsRedraw() const { return m_needsRedraw; }
+// 입력창이 활성화되어 있으면 다음 커서 깜빡임 때 깨어남
+sf::Time SettingScreen::idleTimeout() const {
+    return m_activeInputBox ? m_activeInputBox->timeUntilCursorBlink() : sf::Time::Zero;
 }
 
 // 마우스 위치에 따른 버튼 호버 스타일 업데이트 함수
@@ -612,181 +711,125 @@ void SettingScreen::updateButtonHovers(const sf::Vector2f& mousePos) {
     updateVisuals(m_buttonCreateWindow, m_shapeCreateWindow, m_shapeCreateWindow.getGlobalBounds().contains(mousePos));
     updateVisuals(m_buttonRemovePassage, m_shapeRemovePassage, m_shapeRemovePassage.getGlobalBounds().contains(mousePos));
     updateVisuals(m_buttonRemoveWindow, m_shapeRemoveWindow, m_shapeRemoveWindow.getGlobalBounds().contains(mousePos));
+    updateVisuals(m_buttonSaveScenario, m_shapeSaveScenario, m_shapeSaveScenario.getGlobalBounds().contains(mousePos));
+    updateVisuals(m_buttonLoadScenario, m_shapeLoadScenario, m_shapeLoadScenario.getGlobalBounds().contains(mousePos));
+    updateVisuals(m_buttonResetRoom, m_shapeResetRoom, m_shapeResetRoom.getGlobalBounds().contains(mousePos));
     updateVisuals(m_buttonStartSimulation, m_shapeStartSimulation, m_shapeStartSimulation.getGlobalBounds().contains(mousePos));
 }
 
 // 화면 상태 업데이트 함수 (매 프레임 호출)
 void SettingScreen::update(sf::Time dt) {
-    // 각 입력창의 상태 업데이트 (커서 깜빡임 등)
-    m_inputWidth.update();
-    m_inputDepth.update();
-    m_inputHeight.update();
+    // 각 입력창의 상태 업데이트 (커서 깜빡임 등), 커서가 깜빡였으면 다시 그림 (|는 세 입력창 모두 갱신하기 위함)
+    if (m_inputWidth.update() | m_inputDepth.update() | m_inputHeight.update()) m_needsRedraw = true;
 
     // UI 뷰 기준 마우스 좌표로 버튼 호버 효과 업데이트
     sf::Vector2f mousePosUI = m_window.mapPixelToCoords(sf::Mouse::getPosition(m_window), m_uiView);
     updateButtonHovers(mousePosUI);
 }
 
-// 3D 육면체의 모서리를 그리는 함수
-void SettingScreen::drawCuboidEdges(sf::RenderWindow& window) {
-    // 모든 모서리에 대해 반복
-    for(const auto& edge : m_cubeEdges) {
-        // 모서리를 이루는 두 정점의 2D 화면 좌표 계산
-        sf::Vector2f p1_screen = project(m_transformedVertices[edge.start]);
-        sf::Vector2f p2_screen = project(m_transformedVertices[edge.end]);
-        // 두 점을 잇는 선분 생성 및 그리기
-        sf::Vertex line[] = {
-            sf::Vertex(p1_screen, sf::Color::White),
-            sf::Vertex(p2_screen, sf::Color::White)
-        };
-        window.draw(line, 2, sf::Lines); // sf::Lines 프리미티브 타입으로 그리기
-    }
-}
-
-// 통로 생성 함수 (최대 2개)
-void SettingScreen::createPassage() {
-    if (m_passages_defs.size() < 2) { // 통로 개수 제한 확인
-        OpeningDefinition new_passage; // 새 통로 정의 객체
-        // 통로의 정규화된 높이/너비 절반 계산
-        float p_h_norm = PASSAGE_RELATIVE_HEIGHT_FACTOR * 0.5f; 
-        float p_w_norm = PASSAGE_RELATIVE_WIDTH_FACTOR * 0.5f;  
-
-        // 첫 번째 통로는 앞면(z=-0.5) 중앙에 생성
-        if (m_passages_defs.empty()) { 
-            new_passage.local_coords = {{
-                {-p_w_norm, -p_h_norm, -0.5f}, { p_w_norm, -p_h_norm, -0.5f},
-                { p_w_norm,  p_h_norm, -0.5f}, {-p_w_norm,  p_h_norm, -0.5f}
-            }};
-        } else { // 두 번째 통로는 뒷면(z=0.5) 중앙에 생성
-             new_passage.local_coords = {{
-                {-p_w_norm, -p_h_norm,  0.5f}, { p_w_norm, -p_h_norm,  0.5f},
-                { p_w_norm,  p_h_norm,  0.5f}, {-p_w_norm,  p_h_norm,  0.5f}
-            }};
-        }
-        m_passages_defs.push_back(new_passage); // 생성된 통로 정보 추가
-        updatePassageCountText(); // 통로 개수 텍스트 업데이트
-        projectVertices(); // 3D 뷰 갱신 (실제로는 drawOpenings에서 그려짐)
-    }
+// 종류별 n번째 개구부의 기본 위치 (통로는 앞/뒤/왼쪽/오른쪽, 창문은 왼쪽/오른쪽/앞/뒤 벽 중앙을 차례로 사용)
+static FacePlacement defaultPlacement(OpeningKind kind, int index, float halfWidth, float halfHeight) {
+    static const RoomFace PASSAGE_FACES[4] = {RoomFace::Front, RoomFace::Back, RoomFace::Left, RoomFace::Right};
+    static const RoomFace WINDOW_FACES[4] = {RoomFace::Left, RoomFace::Right, RoomFace::Front, RoomFace::Back};
+    RoomFace face = (kind == OpeningKind::Passage ? PASSAGE_FACES : WINDOW_FACES)[index % 4];
+    return {face, 0.f, 0.f, halfWidth, halfHeight}; // 벽면은 u가 수평, v가 높이 축
 }
 
-// 통로 제거 함수 (가장 최근에 추가된 통로부터 제거)
-void SettingScreen::removePassage() {
-    if (!m_passages_defs.empty()) { // 통로가 존재할 때만
-        m_passages_defs.pop_back(); // 마지막 통로 제거
-        updatePassageCountText(); // 통로 개수 텍스트 업데이트
-        projectVertices(); // 3D 뷰 갱신
-    }
+// 통로/창문 생성 함수 (개수 제한 없음, 새 개구부를 선택해 바로 옮길 수 있게 함)
+void SettingScreen::createOpening(OpeningKind kind) {
+    bool passage = kind == OpeningKind::Passage;
+    // 정규화된 너비/높이 절반
+    float halfWidth = (passage ? PASSAGE_RELATIVE_WIDTH_FACTOR : WINDOW_RELATIVE_WIDTH_FACTOR) * 0.5f;
+    float halfHeight = (passage ? PASSAGE_RELATIVE_HEIGHT_FACTOR : WINDOW_RELATIVE_HEIGHT_FACTOR) * 0.5f;
+    int sameKind = static_cast<int>(std::count_if(m_openings.begin(), m_openings.end(), [kind](const ScenarioOpening& o) { return o.kind() == kind; }));
+    m_openings.emplace_back(kind, defaultPlacement(kind, sameKind, halfWidth, halfHeight));
+    m_selectedOpening = static_cast<int>(m_openings.size()) - 1;
+    updateOpeningTexts(); // 개수/환기량 텍스트 업데이트
+    updateSceneOpenings(); // 3D 뷰 개구부 갱신
 }
 
-// 창문 생성 함수 (최대 2개)
-void SettingScreen::createWindow() {
-    if (m_windows_defs.size() < 2) { // 창문 개수 제한 확인
-        OpeningDefinition new_window; // 새 창문 정의 객체
-        // 창문의 정규화된 높이/깊이(또는 너비) 절반 계산
-        float w_h_norm = WINDOW_RELATIVE_HEIGHT_FACTOR * 0.5f; 
-        float w_d_norm = WINDOW_RELATIVE_WIDTH_FACTOR * 0.5f;  
-
-        // 첫 번째 창문은 왼쪽 면(x=-0.5) 중앙에 생성
-        if (m_windows_defs.empty()) { 
-            new_window.local_coords = {{
-                {-0.5f, -w_h_norm, -w_d_norm}, {-0.5f, -w_h_norm,  w_d_norm},
-                {-0.5f,  w_h_norm,  w_d_norm}, {-0.5f,  w_h_norm, -w_d_norm}
-            }};
-        } else { // 두 번째 창문은 오른쪽 면(x=0.5) 중앙에 생성
-            new_window.local_coords = {{
-                { 0.5f, -w_h_norm, -w_d_norm}, { 0.5f, -w_h_norm,  w_d_norm},
-                { 0.5f,  w_h_norm,  w_d_norm}, { 0.5f,  w_h_norm, -w_d_norm}
-            }};
+// 통로/창문 제거 함수 (선택한 개구부가 그 종류면 선택한 것, 아니면 가장 최근에 추가된 것부터 제거)
+void SettingScreen::removeOpening(OpeningKind kind) {
+    int index = -1;
+    if (m_selectedOpening >= 0 && m_openings[m_selectedOpening].kind() == kind) {
+        index = m_selectedOpening;
+    } else {
+        for (int i = static_cast<int>(m_openings.size()) - 1; i >= 0 && index < 0; --i) {
+            if (m_openings[i].kind() == kind) index = i;
         }
-        m_windows_defs.push_back(new_window); // 생성된 창문 정보 추가
-        updateWindowCountText(); // 창문 개수 텍스트 업데이트
-        projectVertices(); // 3D 뷰 갱신
     }
+    if (index < 0) return; // 해당 종류 개구부가 없음
+    m_openings.erase(m_openings.begin() + index);
+    if (m_selectedOpening == index) m_selectedOpening = -1;
+    else if (m_selectedOpening > index) --m_selectedOpening;
+    m_isMovingOpening = false;
+    updateOpeningTexts(); // 개수/환기량 텍스트 업데이트
+    updateSceneOpenings(); // 3D 뷰 개구부 갱신
 }
 
-// 창문 제거 함수 (가장 최근에 추가된 창문부터 제거)
-void SettingScreen::removeWindow() {
-    if (!m_windows_defs.empty()) { // 창문이 존재할 때만
-        m_windows_defs.pop_back(); // 마지막 창문 제거
-        updateWindowCountText(); // 창문 개수 텍스트 업데이트
-        projectVertices(); // 3D 뷰 갱신
-    }
+// 개구부 선택 및 강조 표시
+void SettingScreen::selectOpening(int index) {
+    m_selectedOpening = index;
+    m_scene.setHighlight(index, sf::Color::Yellow);
 }
 
-// 생성된 통로 및 창문(개구부)들을 3D 공간에 그리는 함수
-void SettingScreen::drawOpenings(sf::RenderWindow& window) {
-    // 단일 개구부(사각형)를 그리는 람다 함수
-    auto draw_one_opening_shape = [&](const OpeningDefinition& def) {
-        std::array<sf::Vector2f, 4> screen_points; // 개구부의 4개 꼭짓점의 2D 화면 좌표
-        
-        // 현재 방 크기 및 3D 뷰 스케일 팩터 (projectVertices와 동일 로직)
-        float w = (m_roomWidth > 0.1f) ? m_roomWidth : 0.1f;
-        float d = (m_roomDepth > 0.1f) ? m_roomDepth : 0.1f;
-        float h = (m_roomHeight > 0.1f) ? m_roomHeight : 0.1f;
-        float maxDim = std::max({w, d, h, 1.f});
-        float viewScaleFactor = 350.f / maxDim;
-
-        // 개구부의 4개 로컬 정규화 좌표를 월드 좌표로 변환 후 화면에 투영
-        for (size_t i = 0; i < 4; ++i) {
-            const Vec3D& v_local_norm = def.local_coords[i]; // 개구부의 로컬 정규화 좌표
-
-            // 로컬 좌표를 실제 방 크기에 맞게 스케일링 (월드 좌표로 변환)
-            Vec3D v_world_scaled;
-            v_world_scaled.x = v_local_norm.x * w;
-            v_world_scaled.y = v_local_norm.y * h;
-            v_world_scaled.z = v_local_norm.z * d;
-
-            // 시점 변환 (회전) 적용
-            float x_rot_y = v_world_scaled.x * std::cos(m_rotationY) - v_world_scaled.z * std::sin(m_rotationY);
-            float z_rot_y = v_world_scaled.x * std::sin(m_rotationY) + v_world_scaled.z * std::cos(m_rotationY);
-            float y_rotated = v_world_scaled.y * std::cos(m_rotationX) - z_rot_y * std::sin(m_rotationX);
-            float z_rotated_final = v_world_scaled.y * std::sin(m_rotationX) + z_rot_y * std::cos(m_rotationX);
-
-            // 3D 뷰 스케일 적용
-            Vec3D v_transformed_for_projection = {
-                x_rot_y * viewScaleFactor,
-                y_rotated * viewScaleFactor,
-                z_rotated_final * viewScaleFactor
-            };
-            
-            screen_points[i] = project(v_transformed_for_projection); // 2D 화면 좌표로 투영
-        }
-
-        // 투영된 4개의 점을 이어 사각형 모서리 그리기
-        for (size_t i = 0; i < 4; ++i) {
-            sf::Vertex line[] = {
-                sf::Vertex(screen_points[i], sf::Color::White), // 개구부 선 색상
-                sf::Vertex(screen_points[(i + 1) % 4], sf::Color::White) // 다음 점과 연결 ((i+1)%4는 순환 위함)
-            };
-            window.draw(line, 2, sf::Lines);
-        }
-    };
-
-    // 모든 통로 그리기
-    for (const auto& passage_def : m_passages_defs) {
-        draw_one_opening_shape(passage_def);
-    }
-    // 모든 창문 그리기
-    for (const auto& window_def : m_windows_defs) {
-        draw_one_opening_shape(window_def);
-    }
+// 면 위 (u, v) 방향 단위 이동이 화면에서 움직이는 양(야코비안)을 구해 화면 이동량을 면 좌표 이동량으로 변환
+// 모서리를 넘는 판단은 누적 위치(m_dragPlacement)로 하고, 개구부는 면 안으로 보정한 위치에 배치
+// 바뀐 개구부 하나의 꼭짓점과 캐시만 갱신하므로 끄는 동안 매 이동마다 환기량을 다시 계산해도 가벼움
+void SettingScreen::moveSelectedOpening(const sf::Vector2f& screenDelta) {
+    if (m_selectedOpening < 0) return;
+    const float PROBE = 0.1f; // 야코비안 계산용 면 좌표 간격
+    FacePlacement current = ScenarioOpening::clampToFace(m_dragPlacement);
+    sf::Vector2f origin = m_scene.projectPoint(ScenarioOpening::facePoint(current.face, current.u, current.v));
+    sf::Vector2f alongU = (m_scene.projectPoint(ScenarioOpening::facePoint(current.face, current.u + PROBE, current.v)) - origin) / PROBE;
+    sf::Vector2f alongV = (m_scene.projectPoint(ScenarioOpening::facePoint(current.face, current.u, current.v + PROBE)) - origin) / PROBE;
+    float det = alongU.x * alongV.y - alongU.y * alongV.x;
+    if (std::fabs(det) < 1.f) return; // 면이 시선과 거의 나란하면 이동 방향을 정할 수 없음
+    float du = (screenDelta.x * alongV.y - screenDelta.y * alongV.x) / det;
+    float dv = (alongU.x * screenDelta.y - alongU.y * screenDelta.x) / det;
+    m_dragPlacement = ScenarioOpening::slide(m_dragPlacement, du, dv);
+    m_openings[m_selectedOpening].place(ScenarioOpening::clampToFace(m_dragPlacement));
+    m_scene.setOpening(static_cast<std::size_t>(m_selectedOpening), m_openings[m_selectedOpening].corners());
+    updateOpeningTexts();
 }
 
-// 통로 개수 표시 텍스트 업데이트 함수
-void SettingScreen::updatePassageCountText() {
-    std::wstring text = L"통로 개수 (" + std::to_wstring(m_passages_defs.size()) + L"/2)";
-    m_textPassageCount.setString(text);
-    // 텍스트 내용 변경 시 원점 재설정 (중앙 정렬 유지)
-    sf::FloatRect bounds = m_textPassageCount.getLocalBounds();
-    m_textPassageCount.setOrigin(std::round(bounds.left + bounds.width / 2.f), std::round(bounds.top + bounds.height / 2.f));
+// 휠 한 칸마다 OPENING_RESIZE_STEP배 (면을 넘지 않도록 보정)
+void SettingScreen::resizeSelectedOpening(float wheelDelta) {
+    if (m_selectedOpening < 0) return;
+    float scale = std::pow(OPENING_RESIZE_STEP, wheelDelta);
+    bool widthOnly = sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || sf::Keyboard::isKeyPressed(sf::Keyboard::RShift);
+    bool heightOnly = sf::Keyboard::isKeyPressed(sf::Keyboard::LControl) || sf::Keyboard::isKeyPressed(sf::Keyboard::RControl);
+    FacePlacement placement = m_openings[m_selectedOpening].placement();
+    if (!heightOnly) placement.halfU *= scale;
+    if (!widthOnly) placement.halfV *= scale;
+    m_openings[m_selectedOpening].place(ScenarioOpening::clampToFace(placement));
+    m_scene.setOpening(static_cast<std::size_t>(m_selectedOpening), m_openings[m_selectedOpening].corners());
+    updateOpeningTexts();
 }
 
-// 창문 개수 표시 텍스트 업데이트 함수
-void SettingScreen::updateWindowCountText() {
-    std::wstring text = L"창문 개수 (" + std::to_wstring(m_windows_defs.size()) + L"/2)";
-    m_textWindowCount.setString(text);
-    sf::FloatRect bounds = m_textWindowCount.getLocalBounds();
-    m_textWindowCount.setOrigin(std::round(bounds.left + bounds.width / 2.f), std::round(bounds.top + bounds.height / 2.f));
+// 통로/창문 개수와 환기량 표시 텍스트 업데이트 함수 (환기량은 개구부별 캐시된 넓이에 방 크기만 곱해 합산)
+void SettingScreen::updateOpeningTexts() {
+    int numPassages = 0;
+    float flow = 0.f;
+    for (const auto& opening : m_openings) {
+        if (opening.kind() == OpeningKind::Passage) ++numPassages;
+        flow += opening.flow(m_roomWidth, m_roomDepth, m_roomHeight);
+    }
+    int numWindows = static_cast<int>(m_openings.size()) - numPassages;
+    // 텍스트 내용 변경 시 원점 재설정 (중앙 정렬 유지)
+    auto setCentered = [](sf::Text& text, const std::wstring& str) {
+        text.setString(str);
+        sf::FloatRect bounds = text.getLocalBounds();
+        text.setOrigin(std::round(bounds.left + bounds.width / 2.f), std::round(bounds.top + bounds.height / 2.f));
+    };
+    setCentered(m_textPassageCount, L"통로 개수 (" + std::to_wstring(numPassages) + L")");
+    setCentered(m_textWindowCount, L"창문 개수 (" + std::to_wstring(numWindows) + L")");
+
+    float volume = ConcentrationModel::roomVolume({m_roomWidth, m_roomDepth, m_roomHeight, m_selectedPollutantIndex, numPassages, numWindows});
+    if (m_mesh) volume *= m_mesh->fillFraction(); // 다면체 방은 경계 상자 중 방이 차지하는 비율만큼
+    std::wostringstream ss;
+    ss << std::fixed << std::setprecision(2) << L"환기량 " << flow << L" m³/min (K +" << std::setprecision(3) << flow / volume << L"/min)";
+    setCentered(m_textExchange, ss.str());
 }
 
 // 화면 렌더링 함수 (매 프레임 호출)
@@ -795,8 +838,7 @@ void SettingScreen::render() {
 
     // 3D 뷰 렌더링
     m_window.setView(m_3dView);      // 3D 뷰 활성화
-    drawCuboidEdges(m_window);       // 육면체 모서리 그리기
-    drawOpenings(m_window);          // 통로 및 창문 그리기
+    m_scene.draw(m_window);          // 방 윤곽선과 통로/창문을 한 번에 그리기
 
     // UI 뷰 렌더링
     m_window.setView(m_uiView);      // UI 뷰 활성화
@@ -820,15 +862,26 @@ void SettingScreen::render() {
     m_window.draw(m_shapeRemovePassage); m_window.draw(m_buttonRemovePassage);
     m_window.draw(m_shapeRemoveWindow);  m_window.draw(m_buttonRemoveWindow);
 
-    // 통로/창문 개수 텍스트 그리기
+    // 통로/창문 개수, 환기량, 개구부 편집 안내 텍스트 그리기
     m_window.draw(m_textPassageCount);
     m_window.draw(m_textWindowCount);
+    m_window.draw(m_textExchange);
+    m_window.draw(m_textOpeningHelp);
+    // 다면체 방 정보와 직육면체로 되돌리기 버튼
+    if (m_mesh) {
+        m_window.draw(m_textRoomMesh);
+        m_window.draw(m_shapeResetRoom); m_window.draw(m_buttonResetRoom);
+    }
+
+    // 시나리오 저장/불러오기 버튼 그리기
+    m_window.draw(m_shapeSaveScenario); m_window.draw(m_buttonSaveScenario);
+    m_window.draw(m_shapeLoadScenario); m_window.draw(m_buttonLoadScenario);
 
     // "시뮬레이션 시작" 버튼 그리기
     m_window.draw(m_shapeStartSimulation); m_window.draw(m_buttonStartSimulation);
 
     m_window.setView(m_window.getDefaultView()); // 뷰를 기본값으로 복원
-    m_window.display(); // 그려진 내용 화면에 최종 표시
+    m_needsRedraw = false;
 }
 
 // 다음 화면 상태 반환
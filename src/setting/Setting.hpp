@@ -5,17 +5,11 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <memory>
 #include "../screen/Screen.hpp"
-
-// 3D 좌표를 나타내는 간단한 구조체
-struct Vec3D {
-    float x, y, z; // x, y, z 좌표
-};
-
-// 3D 모델의 모서리를 나타내는 구조체 (두 정점 인덱스 저장)
-struct Edge {
-    int start, end; // 모서리를 구성하는 시작 정점과 끝 정점의 인덱스
-};
+#include "../core/Geometry.hpp" // Vec3D, Edge 구조체
+#include "../screen/RoomScene.hpp"
+#include "../core/Scenario.hpp"
 
 // 사용자 입력을 받는 텍스트 상자 클래스
 class InputBox {
@@ -26,8 +20,8 @@ public:
     void setup(const sf::Font& font, sf::Vector2f position, sf::Vector2f size, const std::wstring& placeholder);
     // 이벤트 처리 함수 (주로 키 입력)
     void handleEvent(sf::Event event);
-    // 상태 업데이트 함수 (커서 깜빡임 등)
-    void update();
+    // 상태 업데이트 함수 (커서 깜빡임 등), 커서 표시 상태가 바뀌면 true 반환
+    bool update();
     // 렌더링 함수 (화면에 InputBox 그리기)
     void render(sf::RenderWindow& window);
     // InputBox 활성화/비활성화 설정 함수
@@ -42,6 +36,10 @@ public:
     float getFloatValue() const;
     // InputBox의 전역 경계(위치 및 크기) 반환 함수 (마우스 클릭 감지 등에 사용)
     sf::FloatRect getGlobalBounds() const;
+    // 다음 커서 깜빡임까지 남은 시간 반환 함수 (비활성 상태면 Zero)
+    sf::Time timeUntilCursorBlink() const;
+
+    static const float CURSOR_BLINK_INTERVAL; // 커서 깜빡임 간격 (초)
 
 private:
     sf::RectangleShape m_shape;         // InputBox의 배경 모양 (사각형)
@@ -62,13 +60,20 @@ public:
     // 소멸자
     ~SettingScreen();
 
-    // 사용자 입력을 처리하는 함수
-    void handleInput();
+    // 이벤트 하나를 처리하는 함수 (메인 루프가 받은 이벤트 전달)
+    void handleEvent(const sf::Event& event);
     // 화면의 상태를 업데이트하는 함수 (시간 경과에 따른 변화 등)
     void update(sf::Time dt); // dt: delta time (프레임 간 시간 간격)
-    // 화면의 모든 요소를 그리는 함수
+    // 화면의 모든 요소를 그리는 함수 (display는 메인 루프가 오버레이까지 그린 뒤 호출)
     void render();
 
+    // 매 프레임 갱신이 필요한지 (움직이는 요소가 있는지) 여부
+    bool isAnimating() const;
+    // 마지막 렌더링 이후 화면이 바뀌었는지 여부
+    bool needsRedraw() const;
+    // 애니메이션이 없을 때 이벤트 없이도 깨어나야 하는 최대 대기 시간 (Zero면 다음 이벤트까지 대기)
+    sf::Time idleTimeout() const;
+
     // 다음으로 전환될 화면 상태를 반환하는 함수
     ScreenState getNextState() const;
     // 현재 화면이 계속 실행 중인지 여부를 반환하는 함수
@@ -77,16 +82,14 @@ public:
     void setNextState(ScreenState state);
     // 화면의 상태를 초기 상태로 리셋하는 함수
     void reset();
+    // 현재 설정값(방 크기, 오염물질, 통로/창문 형상)으로 만든 시나리오 (시뮬레이션 화면으로 넘길 때 사용)
+    Scenario scenario() const;
+    // OBJ/PLY 파일의 다면체 방 가져오기 (방 크기 입력은 모델 경계 상자 크기로 바뀜, 실패하면 false이고 현재 방 유지)
+    bool importRoomMesh(const std::string& filename);
 
     // 화면 실행 여부 플래그 (main 루프에서 접근 가능하도록 public)
     bool m_running;
 
-    // 통로나 창문의 정의를 위한 내부 구조체
-    // SimulationScreen에서도 시각적 재구성을 위해 이 정의를 사용할 수 있도록 public으로 선언
-    struct OpeningDefinition {
-        std::array<Vec3D, 4> local_coords; // 개구부를 구성하는 4개 정점의 로컬 정규화 좌표
-    };
-
 private:
     // SFML 렌더링 창 및 폰트에 대한 참조
     sf::RenderWindow& m_window;
@@ -112,33 +115,44 @@ private:
     // UI 요소: 버튼 텍스트들
     sf::Text m_buttonCreatePassage, m_buttonCreateWindow; // 통로/창문 생성 버튼
     sf::Text m_buttonRemovePassage, m_buttonRemoveWindow; // 통로/창문 제거 버튼
+    sf::Text m_buttonSaveScenario, m_buttonLoadScenario; // 시나리오 파일 저장/불러오기 버튼
     sf::Text m_buttonStartSimulation;                   // 시뮬레이션 시작 버튼
+    sf::Text m_buttonResetRoom;                         // 다면체 방을 직육면체로 되돌리는 버튼 (다면체 방일 때만 표시)
     // UI 요소: 버튼 모양들
     sf::RectangleShape m_shapeCreatePassage, m_shapeCreateWindow;
     sf::RectangleShape m_shapeRemovePassage, m_shapeRemoveWindow;
+    sf::RectangleShape m_shapeSaveScenario, m_shapeLoadScenario;
     sf::RectangleShape m_shapeStartSimulation;
+    sf::RectangleShape m_shapeResetRoom;
 
     // UI 요소: 통로 및 창문 개수 표시 텍스트
     sf::Text m_textPassageCount;
     sf::Text m_textWindowCount;
+    // UI 요소: 개구부 전체 환기량 표시 텍스트와 개구부 편집 안내
+    sf::Text m_textExchange;
+    sf::Text m_textOpeningHelp;
+    // UI 요소: 다면체 방 정보 (파일 이름, 삼각형 수, 경계 상자 채움 비율, 다면체 방일 때만 표시)
+    sf::Text m_textRoomMesh;
 
     // 3D 모델링 관련 멤버 변수
-    std::array<Vec3D, 8> m_cubeVertices;        // 육면체의 기본 8개 정점 (로컬 정규화 좌표)
-    std::array<Vec3D, 8> m_transformedVertices; // 변환(회전, 크기 조절)된 정점 좌표
-    std::vector<Edge> m_cubeEdges;              // 육면체의 모서리 정보
+    RoomScene m_scene;                          // 3D 방 장면 (회전각/방 크기/개구부가 바뀔 때만 변환 및 와이어프레임 재계산)
     float m_roomWidth, m_roomDepth, m_roomHeight; // 현재 설정된 방의 실제 크기
-    float m_rotationX, m_rotationY;             // 3D 뷰의 X축, Y축 회전 각도 (라디안)
     bool m_isDragging;                          // 마우스로 3D 뷰를 드래그 중인지 여부
+    bool m_isMovingOpening;                     // 선택한 개구부를 끌어 옮기는 중인지 여부
+    FacePlacement m_dragPlacement;              // 끌기 중 누적된 개구부 위치 (면 범위 보정 전)
     sf::Vector2i m_lastMousePos;                // 마지막 마우스 위치 (드래그 계산용)
     sf::View m_3dView;                          // 3D 장면을 렌더링하기 위한 뷰
     sf::View m_uiView;                          // UI 요소를 렌더링하기 위한 뷰
 
     // 현재 활성화된(클릭된) InputBox 객체를 가리키는 포인터
     InputBox* m_activeInputBox;
+    // 마지막 렌더링 이후 화면이 바뀌었는지 여부 (이벤트/커서 깜빡임 시 true, render() 후 false)
+    bool m_needsRedraw;
 
-    // 생성된 통로 및 창문들의 정의를 저장하는 벡터
-    std::vector<OpeningDefinition> m_passages_defs;
-    std::vector<OpeningDefinition> m_windows_defs;
+    // 생성된 통로 및 창문 (추가한 순서, 개수 제한 없음, 면/넓이 캐시 포함)
+    std::vector<ScenarioOpening> m_openings;
+    int m_selectedOpening;                      // 선택한 개구부 인덱스 (-1이면 없음)
+    std::shared_ptr<const RoomMesh> m_mesh;     // 다면체 방 (없으면 직육면체)
 
     // 통로 및 창문의 상대적 크기를 정의하는 static const 멤버 상수 (선언부)
     // 실제 값은 .cpp 파일에 정의됨
@@ -146,34 +160,36 @@ private:
     static const float PASSAGE_RELATIVE_WIDTH_FACTOR;  // 통로 너비 비율
     static const float WINDOW_RELATIVE_HEIGHT_FACTOR;  // 창문 높이 비율
     static const float WINDOW_RELATIVE_WIDTH_FACTOR;   // 창문 너비 비율
+    static const float OPENING_RESIZE_STEP;            // 마우스 휠 한 칸당 개구부 크기 배율
 
     // private 헬퍼 함수들: 클래스 내부 로직 구현
-    // 현재 설정된 값들을 파일에 저장하는 함수
-    void saveSettingsToFile(const std::string& filename) const;
-
-    // 통로/창문 생성 및 제거 함수
-    void createPassage();
-    void removePassage();
-    void createWindow();
-    void removeWindow();
-    // 생성된 통로/창문을 3D 뷰에 그리는 함수
-    void drawOpenings(sf::RenderWindow& window);
-
-    // 통로/창문 개수 표시 텍스트 업데이트 함수
-    void updatePassageCountText();
-    void updateWindowCountText();
+    // 현재 설정을 시나리오 파일(Scenario::DEFAULT_FILE)로 저장 / 파일에서 불러와 화면에 반영 (버튼 또는 Ctrl+S, Ctrl+O)
+    void saveScenario() const;
+    void loadScenario();
+    // 시나리오 값을 입력창, 오염물질 선택, 통로/창문 목록, 3D 장면에 반영
+    void applyScenario(const Scenario& scenario);
+
+    // 통로/창문 생성 (종류별로 앞/뒤/왼쪽/오른쪽 벽을 돌아가며 중앙에 배치하고 선택) 및 제거 (선택한 개구부, 없으면 마지막 개구부)
+    void createOpening(OpeningKind kind);
+    void removeOpening(OpeningKind kind);
+    // 개구부 선택 (-1이면 선택 해제, 3D 장면에서 강조 표시)
+    void selectOpening(int index);
+    // 선택한 개구부를 화면상 이동량만큼 면을 따라 옮기기 / 마우스 휠 칸 수만큼 크기 조절 (Shift: 가로만, Ctrl: 세로만)
+    void moveSelectedOpening(const sf::Vector2f& screenDelta);
+    void resizeSelectedOpening(float wheelDelta);
+    // 생성된 통로/창문을 3D 장면의 개구부 목록에 반영하는 함수
+    void updateSceneOpenings();
+
+    // 통로/창문 개수와 환기량 표시 텍스트 업데이트 함수 (개구부나 방 크기가 바뀔 때 호출)
+    void updateOpeningTexts();
+    // 다면체 방 설정/해제 (nullptr이면 직육면체, 3D 장면 윤곽선과 정보 텍스트 갱신)
+    void setRoomMesh(std::shared_ptr<const RoomMesh> mesh);
 
     // UI 및 3D 요소 초기 설정 함수
     void setupUI();
     void setup3D();
-    // 3D 정점들을 현재 설정에 맞게 변환하는 함수
-    void projectVertices();
-    // 3D 좌표를 2D 화면 좌표로 투영하는 함수
-    sf::Vector2f project(const Vec3D& p) const;
     // 활성화된 입력 상자의 이벤트를 처리하는 함수
     void handleInputBoxEvents(sf::Event event);
-    // 3D 육면체의 모서리를 그리는 함수
-    void drawCuboidEdges(sf::RenderWindow& window);
     // 마우스 위치에 따라 버튼의 호버 스타일을 업데이트하는 함수
     void updateButtonHovers(const sf::Vector2f& mousePos);
 
@@ -5,18 +5,13 @@
 #include <string>
 #include <vector>
 #include <array>
-#include <list>
 #include "../setting/Setting.hpp"
 #include "../screen/Screen.hpp"
-
-// 시뮬레이션 내의 먼지(오염물질) 입자를 나타내는 구조체
-struct Particle {
-    Vec3D position3D;           // 입자의 3D 공간 내 위치 (정규화된 좌표 또는 월드 좌표)
-    sf::CircleShape shape;      // 입자의 시각적 표현 (SFML 원 모양)
-    Vec3D velocity;             // 입자의 3D 공간 내 이동 속도
-    float currentAlpha;         // 입자의 현재 투명도 (0.0 ~ 255.0)
-    float lifetime;             // 입자의 남은 수명 (초 단위)
-};
+#include "../core/Model.hpp"
+#include "../core/SimulationWorker.hpp"
+#include "../core/QualityGovernor.hpp"
+#include "../core/Scenario.hpp"
+#include "../screen/RoomScene.hpp"
 
 // 시뮬레이션 화면을 담당하는 클래스
 class SimulationScreen {
@@ -26,21 +21,30 @@ public:
     // 소멸자
     ~SimulationScreen();
 
-    // 사용자 입력을 처리하는 함수
-    void handleInput();
+    // 이벤트 하나를 처리하는 함수 (메인 루프가 받은 이벤트 전달)
+    void handleEvent(const sf::Event& event);
     // 화면의 상태를 업데이트하는 함수 (시간 경과, 농도 변화, 파티클 움직임 등)
     void update(sf::Time dt); // dt: delta time (프레임 간 시간 간격)
-    // 화면의 모든 요소를 그리는 함수
+    // 화면의 모든 요소를 그리는 함수 (display는 메인 루프가 오버레이까지 그린 뒤 호출)
     void render();
 
+    // 매 프레임 갱신이 필요한지 (시뮬레이션 실행 중이거나 작업자 상태가 아직 변하는 중인지) 여부
+    bool isAnimating() const;
+    // 마지막 렌더링 이후 화면이 바뀌었는지 여부
+    bool needsRedraw() const;
+    // 애니메이션이 없을 때 이벤트 없이도 깨어나야 하는 최대 대기 시간 (Zero면 다음 이벤트까지 대기)
+    sf::Time idleTimeout() const;
+
     // 다음으로 전환될 화면 상태를 반환하는 함수
     ScreenState getNextState() const;
     // 현재 화면이 계속 실행 중인지 여부를 반환하는 함수
     bool isRunning() const;
     // 다음 화면 상태를 설정하는 함수
     void setNextState(ScreenState state);
-    // 화면의 상태를 초기 상태로 리셋하는 함수 (설정값 다시 로드 등)
+    // 화면의 상태를 초기 상태로 리셋하는 함수 (지정된 시나리오 반영, 농도장 재구성 등)
     void reset();
+    // 설정 화면에서 만든 시나리오 지정 (다음 reset()에서 반영)
+    void setScenario(const Scenario& scenario);
 
     // 화면 실행 여부 플래그 (main 루프에서 접근 가능하도록 public)
     bool m_running;
@@ -57,14 +61,28 @@ private:
     // UI 요소: 시뮬레이션 파라미터 입력을 위한 InputBox 객체들 및 해당 라벨
     InputBox m_inputC0, m_inputS, m_inputK; // 초기 농도, 유입 속도, 제거 상수
     sf::Text m_labelC0, m_labelS, m_labelK;
+    // UI 요소: 시뮬레이션 시계 입력 (배속, 이동할 시간) 및 해당 라벨
+    InputBox m_inputSpeed, m_inputSeek;
+    sf::Text m_labelSpeed, m_labelSeek;
     // UI 요소: 계산된 값 또는 상태 표시 텍스트 및 해당 라벨
-    sf::Text m_displayVolume, m_displayTime, m_displayConcentration; // 부피, 시간, 현재 농도
-    sf::Text m_labelVolume, m_labelTime, m_labelConcentration;
+    sf::Text m_displayVolume, m_displayTime, m_displayConcentration, m_displayPeak, m_displayQuality; // 부피, 시간, 현재 농도, 국소 최대 농도, 화질 단계
+    sf::Text m_labelVolume, m_labelTime, m_labelConcentration, m_labelPeak, m_labelQuality;
+    // UI 요소: 타임라인 슬라이더 (드래그하면 해당 시간으로 이동)
+    sf::Text m_labelTimeline;
+    sf::RectangleShape m_timelineTrack, m_timelineHandle;
+    bool m_isScrubbing;            // 타임라인 핸들을 드래그 중인지 여부
+    double m_timelineRangeMinutes; // 타임라인 전체 길이 (분, 드래그 중에는 고정)
 
     // UI 요소: 시뮬레이션 제어 버튼 텍스트들
-    sf::Text m_buttonRun, m_buttonStop, m_buttonReset, m_buttonBack;
+    sf::Text m_buttonRun, m_buttonStop, m_buttonStep, m_buttonSeek, m_buttonReset, m_buttonBack;
     // UI 요소: 시뮬레이션 제어 버튼 모양들
-    sf::RectangleShape m_shapeRun, m_shapeStop, m_shapeReset, m_shapeBack;
+    sf::RectangleShape m_shapeRun, m_shapeStop, m_shapeStep, m_shapeSeek, m_shapeReset, m_shapeBack;
+    // UI 요소: 시계열 기록 시작/중지 버튼 (기록 중에는 쓴 표본 수 표시)
+    sf::Text m_buttonRecord;
+    sf::RectangleShape m_shapeRecord;
+    // UI 요소: 파티클 수 곡선 버튼 (누를 때마다 다음 곡선으로)
+    sf::Text m_buttonRamp;
+    sf::RectangleShape m_shapeRamp;
 
     // 버튼 스타일(색상) 관련 멤버 변수
     sf::Color m_buttonTextColorNormal;
@@ -76,88 +94,81 @@ private:
     // 3D 및 UI 렌더링을 위한 뷰 객체
     sf::View m_3dView;  // 3D 장면용 뷰
     sf::View m_uiView;  // UI 요소용 뷰
-    // 3D 육면체 모델 관련 변수
-    std::array<Vec3D, 8> m_cubeVertices;        // 육면체 기본 정점 (로컬 정규화 좌표)
-    std::array<Vec3D, 8> m_transformedVertices; // 변환(회전, 크기 조절)된 정점 좌표
-    std::vector<Edge> m_cubeEdges;              // 육면체 모서리 정보
-    float m_rotationX, m_rotationY;             // 3D 뷰 회전 각도 (라디안)
+    // 3D 방 장면 (회전각/방 크기/개구부가 바뀔 때만 변환 및 와이어프레임 재계산)
+    RoomScene m_scene;
     bool m_isDragging;                          // 마우스 드래그로 3D 뷰 회전 중인지 여부
     sf::Vector2i m_lastMousePos;                // 마지막 마우스 위치 (드래그 계산용)
 
-    // 설정 화면에서 로드한 통로/창문 정보를 시각적으로 표현하기 위한 구조체 벡터
-    std::vector<SettingScreen::OpeningDefinition> m_passages_vis;
-    std::vector<SettingScreen::OpeningDefinition> m_windows_vis;
+    // 설정 화면에서 넘겨받은 시나리오 (방 크기, 오염물질, 통로/창문 형상)
+    Scenario m_scenario;
 
-    // 시뮬레이션 공간 및 오염물질 관련 파라미터 (설정 파일에서 로드)
+    // 시뮬레이션 공간 및 오염물질 관련 파라미터 (시나리오에서 반영)
     float m_roomWidth, m_roomDepth, m_roomHeight; // 방의 실제 크기
     float m_volumeV;                              // 방의 부피 (계산됨)
     int m_selectedPollutantIndex;                 // 선택된 오염 물질 인덱스
-    int m_numPassages, m_numWindows;              // 통로 및 창문 개수
 
     // 시뮬레이션 핵심 파라미터 (사용자 입력 또는 계산)
     float m_C0;        // 초기 농도 (시뮬레이션 시작 시 고정)
     float m_S_param;   // 유입 속도 (사용자 조절 가능)
     float m_K_param;   // 제거 속도 상수 (사용자 조절 가능)
 
-    // 시뮬레이션 진행 상태 변수
-    float m_currentTime_t;                       // 현재 시뮬레이션 경과 시간 (분)
-    float m_currentConcentration_Ct;             // 현재 시간 t에서의 실제 농도
-    float m_targetConcentration_Ct_for_particles; // 파티클 수 조절을 위한 목표 농도 (부드러운 전환용)
+    // 시뮬레이션 진행 (농도장 적분, 파티클 갱신은 전용 스레드에서 실행하고 화면은 최신 상태 스냅샷만 읽음)
+    SimulationWorker m_worker;
+    // 프레임 시간 예산에 맞춰 파티클 수, 격자 해상도, 텍스트 갱신 간격을 조절하는 화질 조정기
+    QualityGovernor m_governor;
+    sf::Clock m_frameClock;       // 프레임 작업 시간 측정 (update 시작 ~ display 직전, 프레임 제한 대기 제외)
+    float m_textRefreshElapsed;   // 마지막 표시 텍스트 갱신 후 지난 시간 (초)
 
     // 시뮬레이션 제어 플래그
     bool m_simulationActive;      // 시뮬레이션이 현재 실행(활성) 상태인지 여부
     bool m_simulationStartedOnce; // "실행" 버튼이 한 번이라도 눌렸는지 (C0 고정 판단용)
     InputBox* m_activeInputBox;   // 현재 활성화된 InputBox 포인터
+    bool m_needsRedraw;           // 마지막 렌더링 이후 화면이 바뀌었는지 여부 (render() 후 false)
+    bool m_recording;             // 시계열 기록을 요청했는지 여부 (작업자가 명령을 적용하기 전에도 버튼이 바로 바뀌도록 화면이 기억)
+    bool m_recordFailed;          // 마지막 기록 시작이 실패했는지 여부 (파일을 열 수 없음, 다음 시작 전까지 버튼에 표시)
+    std::uint64_t m_recordCommand; // 기록 시작 명령 번호 (작업자가 이 명령까지 적용한 상태에서 기록 중이 아니면 실패)
+    PopulationRamp::Curve m_rampCurve; // 파티클 수가 목표 개수로 다가가는 곡선 (작업자에 보낸 값)
 
-    // 파티클 시스템 관련 멤버 변수
-    std::list<Particle> m_particles;              // 화면에 표시될 모든 파티클 저장 (list로 변경)
+    // 파티클 렌더링 관련 멤버 변수 (파티클 상태는 m_worker 스냅샷)
     sf::Color m_particleColor;                    // 오염물질 종류에 따른 기본 파티클 색상 (알파값은 개별 조절)
-    int m_maxParticles;                           // 화면에 표시될 최대 파티클 수
-    float m_simulationTimeStepAccumulator;      // 시뮬레이션 시간 1분 단위 진행을 위한 누적 시간
+    sf::Texture m_particleTexture;                // 파티클 원 모양 텍스처 (흰색 원, 정점 색상으로 물들임)
+    sf::VertexArray m_particleVertices;           // 모든 파티클의 사각형 정점 (파티클당 삼각형 2개, 한 번에 그림)
 
-    // 파티클 동작 관련 static const 상수 (선언부, 실제 값은 .cpp에 정의)
-    static const float PARTICLE_MAX_LIFETIME;      // 파티클 최대 수명 (초)
-    static const float PARTICLE_FADE_RATE;         // 파티클 사라지는 속도 (초당 알파 감소량)
-    static const int PARTICLES_PER_FRAME_ADJUST; // 프레임당 추가/제거할 파티클 수 (부드러운 변화용)
+    // 파티클 렌더링 관련 static const 상수 (선언부, 실제 값은 .cpp에 정의, 파티클 동작 상수는 SimulationWorker)
+    static const float PARTICLE_RADIUS;            // 가장 가까운 깊이에서의 파티클 화면 반지름 (픽셀)
+    static const unsigned PARTICLE_TEXTURE_SIZE;   // 파티클 텍스처 한 변 픽셀 수
+    static const double TIMELINE_MINUTES;          // 타임라인 기본 길이 (분, 현재 시간이 더 길면 늘어남)
+    static const char* const RECORDING_PREFIX;     // 기록 버튼으로 만드는 시계열 CSV 파일 이름 앞부분 (뒤에 시작 시각)
 
     // private 헬퍼 함수들: 클래스 내부 로직 구현
     void setupUI();    // UI 요소 초기화 및 배치
     void setup3D();    // 3D 뷰 관련 설정 초기화
-    void loadSettingsFromFile(const std::string& filename); // 설정 파일에서 값 로드
-    void reconstructOpenings(); // 로드된 통로/창문 개수에 따라 시각적 개구부 정보 생성
-
-    void projectVertices(); // 3D 정점을 현재 설정에 맞게 변환
-    sf::Vector2f project(const Vec3D& p) const; // 단일 3D 점을 2D 화면 좌표로 투영
-    void drawCuboidEdges(sf::RenderWindow& window);    // 3D 육면체 모서리 그리기
-    void drawOpeningsVisual(sf::RenderWindow& window); // 재구성된 통로/창문 그리기
+    void applyScenario();       // 시나리오의 방 크기/오염물질/개구부를 화면 상태와 3D 장면에 반영
+    void configureField();      // 방 크기와 개구부로 3D 농도장 격자 구성 (작업자에 명령)
+    void updateFieldParameters(); // 현재 S, K를 작업자에 반영 (개구부 환기분은 농도장 경계에서 처리)
+    void updateDisplayTexts();    // 최신 스냅샷으로 시간/농도/화질 표시 텍스트 갱신
+    void applyQuality();          // 현재 화질 단계의 파티클 수와 격자 해상도를 작업자에 반영
+    void updateTimelineHandle(double minutes); // 타임라인 핸들을 시간 위치로 이동
+    void scrubTimeline(float mouseX);          // 마우스 x 위치의 시간으로 이동
 
     void updateButtonHovers(const sf::Vector2f& mousePos); // 버튼 호버 스타일 업데이트
     void handleInputBoxEvents(sf::Event event);           // 활성화된 입력 상자 이벤트 처리
 
+    void applyInputParameters(); // 입력창의 C0(최초 1회), S, K를 확정해 작업자에 반영
     void runSimulation();        // 시뮬레이션 시작
     void stopSimulation();       // 시뮬레이션 일시 중단
+    void stepSimulation();       // 시뮬레이션 시간을 한 단계(SimulationClock::STEP_MINUTES) 진행
+    void seekSimulation();       // 시간 이동 입력창의 시간으로 바로 이동
     void resetSimulationState(); // 시뮬레이션 상태 전체 초기화
-    void calculateCurrentConcentration(); // 현재 농도 계산
+    void toggleRecording();      // 시계열 기록 시작/중지 (작업자가 상태를 넘길 때마다 표본 하나, 시작할 때마다 새 파일)
+    void checkRecordingStarted(); // 작업자가 기록 시작 명령을 적용했는데 기록 중이 아니면 실패 표시
+    void updateRecordButton();   // 기록 상태에 맞춰 기록 버튼 글자 갱신
+    void cycleParticleRamp();    // 파티클 수 곡선을 다음 종류로 바꿔 작업자에 반영 (즉시 → 선형 → smoothstep → ease-out)
+    void updateRampButton();     // 현재 곡선 이름으로 곡선 버튼 글자 갱신
 
     void initializeDefaultSK(); // 오염물질 및 개구부에 따른 S, K 기본값 설정
-    void updateParticleSystem(sf::Time dt); // 파티클 이동, 수명, 알파값 등 업데이트
-    void adjustParticleCount();  // 목표 농도에 맞춰 파티클 수 점진적 조절
-    void spawnNewParticle();     // 새로운 단일 파티클 생성
-
-    // 오염물질별 기본 S, K 값 및 개구부 효과에 대한 static const 상수 (선언부)
-    // 실제 값은 .cpp 파일에 정의됨
-    static const float BASE_S_PM10; static const float BASE_K_PM10;
-    static const float BASE_S_CO;   static const float BASE_K_CO;
-    static const float BASE_S_CL2;  static const float BASE_K_CL2;
-
-    static const float S_ADJUST_PASSAGE; static const float K_ADJUST_PASSAGE;
-    static const float S_ADJUST_WINDOW;  static const float K_ADJUST_WINDOW;
-
-    // SettingScreen과 시각적 일관성을 위한 개구부 상대 크기 계수 (선언부)
-    static const float PASSAGE_RELATIVE_HEIGHT_FACTOR_SIM;
-    static const float PASSAGE_RELATIVE_WIDTH_FACTOR_SIM;
-    static const float WINDOW_RELATIVE_HEIGHT_FACTOR_SIM;
-    static const float WINDOW_RELATIVE_WIDTH_FACTOR_SIM;
+
+    // 오염물질별 기본 S, K 값 및 개구부 효과 상수는 ConcentrationModel(core/Model.hpp)에 정의됨
 };
 
 #endif
\ No newline at end of file